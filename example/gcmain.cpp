@@ -27,6 +27,7 @@
 #if defined(OMR_GC_EXPERIMENTAL_CONTEXT)
 #include <OMR/GC/AccessBarrier.hpp>
 #include <OMR/GC/Allocator.hpp>
+#include <OMR/GC/HeapSlotHandle.hpp>
 #include <OMR/GC/StackRoot.hpp>
 #include <OMR/GC/System.hpp>
 #include <OMR/Runtime.hpp>
@@ -55,7 +56,7 @@
 #if defined(OMR_GC_EXPERIMENTAL_CONTEXT)
 void
 store(OMR::GC::RunContext &cx, Object *object, std::size_t index, Object *value) {
-	OMR::GC::store(cx, object, OMR::GC::RefSlotHandle(&object->slots()[index]), value);
+	OMR::GC::store(cx, object, OMR::GC::makeHeapSlotHandle(&object->slots()[index], cx.system().vm()._compressedPointersShift), value);
 }
 
 Object*
@@ -86,15 +87,15 @@ omr_main_entry(int argc, char ** argv, char **envp)
 	while (true) {
 		for (int i = 0xB; i < 0xA0; i++) {
 			rootB = allocate(cx, nslots);
-			rootB->slots()[0] = i;
+			store(cx, rootB, 0, rootB);
 			store(cx, rootB, 1, rootA);
 			store(cx, rootA, 1, rootB);
 		}
-		OMR_GC_SystemCollect(cx.vm(), 0);
-		OMR_GC_SystemCollect(cx.vm(), 0);
+		OMR_GC_SystemCollect(cx.vmContext(), 0);
+		OMR_GC_SystemCollect(cx.vmContext(), 0);
 	}
 	
-	OMR_GC_SystemCollect(cx.vm(), 0);
+	OMR_GC_SystemCollect(cx.vmContext(), 0);
 
 	return 0;
 
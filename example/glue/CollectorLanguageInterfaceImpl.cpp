@@ -48,11 +48,13 @@
 #include "ParallelGlobalGC.hpp"
 #include "Scavenger.hpp"
 
-#if !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+#include <OMR/GC/HeapSlotHandle.hpp>
+#else /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 #include "MixedObjectScanner.hpp"
 #include "SlotObject.hpp"
 #include "ObjectIterator.hpp"
-#endif /* !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
+#endif /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 
 /**
  * Initialization
@@ -239,8 +241,13 @@ MM_CollectorLanguageInterfaceImpl::scavenger_fixupDestroyedSlot(MM_EnvironmentBa
 		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 		/* Get the uncompressed reference from the slot */
 		fomrobject_t preservedOverlap = (fomrobject_t)forwardedHeader->getPreservedOverlap();
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+		uintptr_t compressedPointersShift = extensions->objectModel.getCompressedPointersShift();
+		omrobjectptr_t survivingCopyAddress = OMR::GC::makeHeapSlotHandle(&preservedOverlap, compressedPointersShift).readReference();
+#else /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 		GC_SlotObject preservedSlotObject(_omrVM, &preservedOverlap);
 		omrobjectptr_t survivingCopyAddress = preservedSlotObject.readReferenceFromSlot();
+#endif /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 		/* Check if the address we want to read is aligned (since mis-aligned reads may still be less than a top address but extend beyond it) */
 		if (0 == ((uintptr_t)survivingCopyAddress & (extensions->getObjectAlignmentInBytes() - 1))) {
 			/* Ensure that the address we want to read is within part of the heap which could contain copied objects (tenure or survivor) */
@@ -251,8 +258,12 @@ MM_CollectorLanguageInterfaceImpl::scavenger_fixupDestroyedSlot(MM_EnvironmentBa
 				if (reverseForwardedHeader.isReverseForwardedPointer()) {
 					/* overlapped slot must be fixed up */
 					fomrobject_t fixupSlot = 0;
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+					OMR::GC::makeHeapSlotHandle(&fixupSlot, compressedPointersShift).writeReference(reverseForwardedHeader.getReverseForwardedPointer());
+#else /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 					GC_SlotObject fixupSlotObject(_omrVM, &fixupSlot);
 					fixupSlotObject.writeReferenceToSlot(reverseForwardedHeader.getReverseForwardedPointer());
+#endif /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
 					forwardedHeader->restoreDestroyedOverlap((uint32_t)fixupSlot);
 				}
 			}
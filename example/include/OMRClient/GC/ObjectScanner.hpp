@@ -24,7 +24,7 @@
 #define OMRCLIENT_GC_OBJECTSCANNER_HPP_
 
 #include <Object.hpp>
-#include <OMR/GC/RefSlotHandle.hpp>
+#include <OMR/GC/HeapSlotHandle.hpp>
 #include <OMR/GC/ScanResult.hpp>
 #include <stdint.h>
 #include <cstddef>
@@ -73,7 +73,7 @@ public:
 			}
 
 			if (*_current > 0xFF) {
-				cont = visitor.edge(_target, OMR::GC::RefSlotHandle(_current));
+				cont = visitor.edge(_target, OMR::GC::makeHeapSlotHandle(_current, _compressedPointersShift));
 			}
 
 			++_current;
@@ -97,11 +97,13 @@ public:
 protected:
 	friend class ::GC_ObjectModelDelegate;
 
-	ObjectScanner() : _target(nullptr), _current(nullptr) {}
+	ObjectScanner(std::size_t compressedPointersShift)
+		: _target(nullptr), _current(nullptr), _compressedPointersShift(compressedPointersShift) {}
 
   private:
 	Object *_target;
 	Slot *_current;
+	std::size_t _compressedPointersShift;
 };
 
 } // namespace GC
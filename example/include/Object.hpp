@@ -30,6 +30,13 @@
 
 typedef uint8_t ObjectFlags;
 
+/**
+ * Language flag bits in the object header flags byte. The high nibble is owned by the GC (object age and
+ * remembered state, see OMR_OBJECT_METADATA_AGE_MASK) and the low three bits overlay the heap hole and
+ * forwarding tags (see ForwardedHeader.hpp), which leaves bit 3 free for the language.
+ */
+#define OBJECT_FLAG_LEAF ((ObjectFlags)0x08) /**< the object's payload holds no references, e.g. a primitive array */
+
 #if defined(OMR_INTERP_COMPRESSED_OBJECT_HEADER)
 typedef uint32_t RawObjectHeader;
 typedef uint32_t ObjectSize;
@@ -75,15 +82,24 @@ private:
 class Object
 {
 public:
+	/** Objects are allocated at, and sized in multiples of, the minimum heap object alignment. */
+	static const ObjectSize ALIGNMENT = 8;
+
+	/** The allocation size of an object with nslots reference slots, rounded up to the object alignment. */
 	static ObjectSize allocSize(ObjectSize nslots) {
-		return ObjectSize(sizeof(ObjectHeader) + (sizeof(fomrobject_t) * nslots));
+		ObjectSize size = ObjectSize(sizeof(ObjectHeader) + (sizeof(fomrobject_t) * nslots));
+		return (size + (ALIGNMENT - 1)) & ~(ALIGNMENT - 1);
 	}
 
 	explicit Object(ObjectSize sizeInBytes, ObjectFlags flags = 0) : header(sizeInBytes, flags) {}
 
 	size_t sizeOfSlotsInBytes() const { return header.sizeInBytes() - sizeof(ObjectHeader); }
 
-	size_t slotCount() const { return sizeOfSlotsInBytes() / sizeof(Slot); }
+	/** Leaf objects carry a non-reference payload, which the GC does not scan. */
+	bool isLeaf() const { return 0 != (header.flags() & OBJECT_FLAG_LEAF); }
+
+	/** The number of reference slots, zero for leaf objects. */
+	size_t slotCount() const { return isLeaf() ? 0 : sizeOfSlotsInBytes() / sizeof(Slot); }
 
 	Slot* slots() { return (Slot*)(this + 1); }
 
@@ -45,6 +45,7 @@ public:
 
 protected:
 private:
+	ObjectFlags _objectFlags; /**< language flags for the new object's header, e.g. OBJECT_FLAG_LEAF */
 
 	/*
 	 * Member functions
@@ -61,7 +62,7 @@ public:
 		omrobjectptr_t objectPtr = (omrobjectptr_t)allocatedBytes;
 
 		if (NULL != objectPtr) {
-			new(objectPtr) Object((ObjectSize)getAllocateDescription()->getBytesRequested()); 
+			new(objectPtr) Object((ObjectSize)getAllocateDescription()->getBytesRequested(), _objectFlags);
 		}
 
 		return objectPtr;
@@ -70,8 +71,9 @@ public:
 	/**
 	 * Constructor.
 	 */
-	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0)
+	MM_ObjectAllocationModel(MM_EnvironmentBase *env,  uintptr_t requiredSizeInBytes, uintptr_t allocateObjectFlags = 0, ObjectFlags objectFlags = 0)
 		: MM_AllocateInitialization(env, allocation_category_example, requiredSizeInBytes, allocateObjectFlags)
+		, _objectFlags(objectFlags)
 	{}
 };
 #endif /* OBJECTALLOCATIONMODEL_HPP_ */
@@ -51,9 +51,14 @@ private:
 		/* Start _scanPtr after header */
 		_scanPtr = (fomrobject_t *)objectPtr + 1;
 
-		MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)omrVM->_gcOmrVMExtensions;
-		uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
-		_endPtr = (fomrobject_t *)((U_8*)objectPtr + size);
+		if (objectPtr->isLeaf()) {
+			/* leaf objects have no reference slots */
+			_endPtr = _scanPtr;
+		} else {
+			MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)omrVM->_gcOmrVMExtensions;
+			uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+			_endPtr = (fomrobject_t *)((U_8*)objectPtr + size);
+		}
 	}
 
 protected:
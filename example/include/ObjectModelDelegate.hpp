@@ -77,9 +77,9 @@ public:
 
 #if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
 	MMINLINE OMRClient::GC::ObjectScanner
-	makeObjectScanner()
+	makeObjectScanner(uintptr_t compressedPointersShift)
 	{
-		return OMRClient::GC::ObjectScanner();
+		return OMRClient::GC::ObjectScanner(compressedPointersShift);
 	}
 #endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
 
@@ -153,6 +153,21 @@ public:
 		return objectPtr->header.sizeInBytes();
 	}
 
+	/**
+	 * Get the key that identifies the type of an object in a heap census. Objects with equal keys are
+	 * counted together. Languages would typically return the address of the class of the object.
+	 *
+	 * Example objects have no class, so they are told apart by size and by whether they hold references.
+	 *
+	 * @param[in] objectPtr points to the object
+	 * @return the census key of the object
+	 */
+	MMINLINE uintptr_t
+	getObjectCensusKey(omrobjectptr_t objectPtr)
+	{
+		return (objectPtr->header.sizeInBytes() << 1) | (objectPtr->isLeaf() ? 1 : 0);
+	}
+
 	/**
 	 * Get the total footprint of an object, in bytes, including the object header and all data.
 	 * If the object has a discontiguous representation, this method should return the size of
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+
+#include "AdaptiveThreadCount.hpp"
+
+#define WORK_PER_THREAD ((uintptr_t)(256 * 1024))
+#define THREAD_COUNT_MAXIMUM ((uintptr_t)8)
+
+TEST(gcFunctionalTestAdaptiveThreadCount, unmeasured)
+{
+	MM_AdaptiveThreadCount adaptive;
+
+	/* nothing has been measured yet, so every thread is dispatched */
+	ASSERT_EQ(THREAD_COUNT_MAXIMUM, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+
+	adaptive.update(0, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)1, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+
+	adaptive.reset();
+	ASSERT_EQ(THREAD_COUNT_MAXIMUM, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+}
+
+TEST(gcFunctionalTestAdaptiveThreadCount, growth)
+{
+	MM_AdaptiveThreadCount adaptive;
+
+	adaptive.update(WORK_PER_THREAD, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)2, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+
+	/* growing work is followed at once */
+	adaptive.update(5 * WORK_PER_THREAD, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)6, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+
+	/* and capped by the dispatcher's thread count */
+	adaptive.update(100 * WORK_PER_THREAD, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ(THREAD_COUNT_MAXIMUM, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+	ASSERT_EQ((uintptr_t)4, adaptive.getThreadCount(4));
+}
+
+TEST(gcFunctionalTestAdaptiveThreadCount, decay)
+{
+	MM_AdaptiveThreadCount adaptive;
+
+	adaptive.update(100 * WORK_PER_THREAD, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)8, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+
+	/* shrinking work is followed halfway per cycle */
+	adaptive.update(0, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)4, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+	adaptive.update(0, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)2, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+	adaptive.update(0, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)1, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+	adaptive.update(0, WORK_PER_THREAD, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ((uintptr_t)1, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+}
+
+TEST(gcFunctionalTestAdaptiveThreadCount, noWorkPerThread)
+{
+	MM_AdaptiveThreadCount adaptive;
+
+	/* without a work per thread the count stays at the maximum */
+	adaptive.update(0, 0, THREAD_COUNT_MAXIMUM);
+	ASSERT_EQ(THREAD_COUNT_MAXIMUM, adaptive.getThreadCount(THREAD_COUNT_MAXIMUM));
+}
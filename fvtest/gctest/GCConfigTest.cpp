@@ -19,15 +19,25 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Math.hpp"
 #include "ObjectAllocationModel.hpp"
+#include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#endif /* OMR_GC_MODRON_STANDARD */
 #include "StandardWriteBarrier.hpp"
 #include "SlotObject.hpp"
+#include "VerboseBinaryDecoder.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -46,11 +56,48 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml",
                                 "fvtest/gctest/configuration/gencon_GC_backout_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_config.xml",
                                 "fvtest/gctest/configuration/scavenger_GC_backout_config.xml",
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								"fvtest/gctest/configuration/scavenger_nontemporal_GC_config.xml",
+								"fvtest/gctest/configuration/scavenger_age_streams_GC_config.xml",
+								"fvtest/gctest/configuration/heap_walk_scavenge_GC_config.xml",
+								"fvtest/gctest/configuration/adaptive_threading_GC_config.xml",
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
                                	"fvtest/gctest/configuration/global_GC_config.xml",
-								"fvtest/gctest/configuration/optavgpause_GC_config.xml"};
+								"fvtest/gctest/configuration/marking_prefetch_GC_config.xml",
+								"fvtest/gctest/configuration/optavgpause_GC_config.xml",
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+								"fvtest/gctest/configuration/concurrent_kickoff_forecast_GC_config.xml",
+								"fvtest/gctest/configuration/concurrent_assist_pacing_GC_config.xml",
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+								"fvtest/gctest/configuration/array_GC_config.xml",
+								"fvtest/gctest/configuration/tlh_adaptive_GC_config.xml",
+								"fvtest/gctest/configuration/tlh_prezero_GC_config.xml",
+								"fvtest/gctest/configuration/hugepage_GC_config.xml",
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+								"fvtest/gctest/configuration/idle_release_GC_config.xml",
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+								"fvtest/gctest/configuration/edge_marking_GC_config.xml",
+								"fvtest/gctest/configuration/heap_walk_GC_config.xml",
+								"fvtest/gctest/configuration/verbose_binary_GC_config.xml",
+								"fvtest/gctest/configuration/verbose_async_GC_config.xml",
+								"fvtest/gctest/configuration/task_phase_times_GC_config.xml",
+								"fvtest/gctest/configuration/heap_census_GC_config.xml",
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								"fvtest/gctest/configuration/heap_census_scavenge_GC_config.xml",
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+								"fvtest/gctest/configuration/retained_size_GC_config.xml"};
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
 								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+
+const char *benchmarkTests[] = {"perftest/gcbench/configuration/arrayHeavy_gencon.xml",
+								"perftest/gcbench/configuration/arrayHeavy_optavgpause.xml",
+								"perftest/gcbench/configuration/treeHeavy_gencon.xml",
+								"perftest/gcbench/configuration/treeHeavy_optavgpause.xml",
+								"perftest/gcbench/configuration/highSurvival_gencon.xml",
+								"perftest/gcbench/configuration/highSurvival_optavgpause.xml",
+								"perftest/gcbench/configuration/bursty_gencon.xml",
+								"perftest/gcbench/configuration/bursty_optavgpause.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -290,8 +337,42 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 	return objType;
 }
 
+uintptr_t
+GCConfigTest::parseElementType(const char *elementTypeStr, ObjectFlags *objectFlags)
+{
+	uintptr_t elementSize = 0;
+	*objectFlags = 0;
+
+	if ((0 == strcmp(elementTypeStr, "reference")) || (0 == strcmp(elementTypeStr, ""))) {
+		elementSize = sizeof(fomrobject_t);
+	} else {
+		/* primitive payloads are never scanned by the GC */
+		*objectFlags = OBJECT_FLAG_LEAF;
+		if (0 == strcmp(elementTypeStr, "int8")) {
+			elementSize = sizeof(int8_t);
+		} else if (0 == strcmp(elementTypeStr, "int16")) {
+			elementSize = sizeof(int16_t);
+		} else if (0 == strcmp(elementTypeStr, "int32")) {
+			elementSize = sizeof(int32_t);
+		} else if (0 == strcmp(elementTypeStr, "int64")) {
+			elementSize = sizeof(int64_t);
+		} else {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: array elementType should be reference, int8, int16, int32 or int64.\n", __FILE__, __LINE__);
+		}
+	}
+
+	return elementSize;
+}
+
+uintptr_t
+GCConfigTest::calculateObjectSize(int32_t numOfElements, uintptr_t elementSize)
+{
+	/* object header followed by the payload, rounded up to a whole number of slots */
+	return sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(fomrobject_t), (uintptr_t)numOfElements * elementSize);
+}
+
 ObjectEntry *
-GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
+GCConfigTest::allocateHelper(const char *objName, uintptr_t size, ObjectFlags objectFlags)
 {
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 
@@ -302,13 +383,13 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
-			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true), objectFlags);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
-				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false), objectFlags);
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
 	}
 
@@ -330,7 +411,7 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 }
 
 ObjectEntry *
-GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size)
+GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size, ObjectFlags objectFlags)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 	ObjectEntry *objEntry = NULL;
@@ -347,7 +428,7 @@ GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int3
 		gcTestEnv->log(LEVEL_VERBOSE, "Found object %s in object table.\n", objEntry->name);
 		omrmem_free_memory(objName);
 	} else {
-		objEntry = allocateHelper(objName, size);
+		objEntry = allocateHelper(objName, size, objectFlags);
 		if (NULL != objEntry) {
 			/* Keep count of the new allocated non-garbage object size for garbage insertion. If the object exists in objectTable, its size is ignored. */
 			if ((ROOT == objType) || (NORMAL == objType)) {
@@ -383,7 +464,7 @@ GCConfigTest::createFixedSizeTree(ObjectEntry **rootEntryIndirectPtr, const char
 	int32_t numOfParents = 1;
 
 	/* allocate the root object and add it to the object table */
-	*rootEntryIndirectPtr = createObject(namePrefixStr, objType, 0, 0, objSize);
+	*rootEntryIndirectPtr = createObject(namePrefixStr, objType, 0, 0, objSize, 0);
 	if (NULL == *rootEntryIndirectPtr) {
 		goto done;
 	}
@@ -421,7 +502,7 @@ GCConfigTest::createFixedSizeTree(ObjectEntry **rootEntryIndirectPtr, const char
 						goto done;
 					}
 				}
-				ObjectEntry *childEntry = createObject(namePrefixStr, objType, depth, nthInRow, objSize);
+				ObjectEntry *childEntry = createObject(namePrefixStr, objType, depth, nthInRow, objSize, 0);
 				if (NULL == childEntry) {
 					goto done;
 				}
@@ -456,7 +537,7 @@ done:
 }
 
 int32_t
-GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth)
+GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth, uintptr_t elementSize, ObjectFlags objectFlags)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
@@ -466,8 +547,8 @@ GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMR
 	/* Create objects and store them in the root table or the slot object based on objType. */
 	if ((ROOT == objType) || (GARBAGE_ROOT == objType)) {
 		for (int32_t i = 0; i < breadthElem->value; i++) {
-			uintptr_t sizeCalculated = numOfFieldsElem->value * sizeof(fomrobject_t) + sizeof(uintptr_t);
-			ObjectEntry *objectEntry = createObject(namePrefixStr, objType, 0, i, sizeCalculated);
+			uintptr_t sizeCalculated = calculateObjectSize(numOfFieldsElem->value, elementSize);
+			ObjectEntry *objectEntry = createObject(namePrefixStr, objType, 0, i, sizeCalculated, objectFlags);
 			if (NULL == objectEntry) {
 				goto done;
 			}
@@ -493,8 +574,8 @@ GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMR
 		char parentName[MAX_NAME_LENGTH];
 		omrstr_printf(parentName, MAX_NAME_LENGTH, "%s_%d_%d", node.parent().attribute(xs.namePrefix).value(), 0, 0);
 		for (int32_t i = 0; i < breadthElem->value; i++) {
-			uintptr_t sizeCalculated = numOfFieldsElem->value * sizeof(fomrobject_t) + sizeof(uintptr_t);
-			ObjectEntry *childEntry = createObject(namePrefixStr, objType, 0, i, sizeCalculated);
+			uintptr_t sizeCalculated = calculateObjectSize(numOfFieldsElem->value, elementSize);
+			ObjectEntry *childEntry = createObject(namePrefixStr, objType, 0, i, sizeCalculated, objectFlags);
 			if (NULL == childEntry) {
 				goto done;
 			}
@@ -532,8 +613,8 @@ GCConfigTest::processObjNode(pugi::xml_node node, const char *namePrefixStr, OMR
 			char parentName[MAX_NAME_LENGTH];
 			omrstr_printf(parentName, sizeof(parentName), "%s_%d_%d", namePrefixStr, (i - 1), j);
 			for (int32_t k = 0; k < breadthElem->value; k++) {
-				uintptr_t sizeCalculated = sizeof(omrobjectptr_t) + numOfFieldsElem->value * sizeof(fomrobject_t);
-				ObjectEntry *childEntry = createObject(namePrefixStr, objType, i, nthInRow, sizeCalculated);
+				uintptr_t sizeCalculated = calculateObjectSize(numOfFieldsElem->value, elementSize);
+				ObjectEntry *childEntry = createObject(namePrefixStr, objType, i, nthInRow, sizeCalculated, objectFlags);
 				if (NULL == childEntry) {
 					goto done;
 				}
@@ -609,7 +690,11 @@ GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry
 	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
 	uintptr_t slotCount = endSlot - firstSlot;
 
-	if ((uint32_t)parentEntry->numOfRef < slotCount) {
+	if (parentEntry->objPtr->isLeaf()) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: primitive array %s(%p[0x%llx]) cannot hold child reference for %s(%p[0x%llx]).\n",
+				__FILE__, __LINE__, parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), childEntry->name, childEntry->objPtr, childEntry->objPtr->header.raw());
+		rc = 1;
+	} else if ((uint32_t)parentEntry->numOfRef < slotCount) {
 		fomrobject_t *childSlot = firstSlot + parentEntry->numOfRef;
 		standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
 		gcTestEnv->log(LEVEL_VERBOSE, "\tadd child %s(%p[0x%llx]) to parent %s(%p[0x%llx]) slot %p[%llx].\n", 
@@ -708,14 +793,18 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 	AttributeElem *breadthElem = NULL;
 	int32_t depth = 0;
 	OMRGCObjectType objType = INVALID;
+	uintptr_t elementSize = sizeof(fomrobject_t);
+	ObjectFlags objectFlags = 0;
+	bool isArray = (0 == strcmp(node.name(), xs.array));
 
 	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
-	const char *numOfFieldsStr = node.attribute(xs.numOfFields).value();
+	/* for arrays, the element count list takes the place of the field count list */
+	const char *numOfFieldsStr = node.attribute(isArray ? xs.length : xs.numOfFields).value();
 	const char *typeStr = node.attribute(xs.type).value();
 	const char *breadthStr = node.attribute(xs.breadth).value();
 	const char *depthStr = node.attribute(xs.depth).value();
 
-	if (0 != strcmp(node.name(), xs.object)) {
+	if (!isArray && (0 != strcmp(node.name(), xs.object))) {
 		/* allow non-object node nested inside allocation? */
 		goto done;
 	}
@@ -732,6 +821,14 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 		depthStr = "1";
 	}
 
+	if (isArray) {
+		elementSize = parseElementType(node.attribute(xs.elementType).value(), &objectFlags);
+		if (0 == elementSize) {
+			rt = 1;
+			goto done;
+		}
+	}
+
 	depth = atoi(depthStr);
 	objType = parseObjectType(node);
 	rt = parseAttribute(&numOfFieldsElem, numOfFieldsStr);
@@ -740,7 +837,7 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 	OMRGCTEST_CHECK_RT(rt);
 
 	/* process current xml node, perform allocation for single object or object tree */
-	rt = processObjNode(node, namePrefixStr, objType, numOfFieldsElem, breadthElem, depth);
+	rt = processObjNode(node, namePrefixStr, objType, numOfFieldsElem, breadthElem, depth, elementSize, objectFlags);
 	OMRGCTEST_CHECK_RT(rt);
 
 	/* only single object can contain nested child object */
@@ -803,6 +900,34 @@ printFile(const char *name)
 }
 #endif
 
+int32_t
+GCConfigTest::decodeBinaryVerboseLog(const char *binaryFile, const char *xmlFile)
+{
+	FILE *input = fopen(binaryFile, "rb");
+	if (NULL == input) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to open binary verbose log %s.\n", __FILE__, __LINE__, binaryFile);
+		return 1;
+	}
+	VerboseBinaryFileHeader fileHeader;
+	std::vector<VerboseBinaryRecord> records;
+	bool success = readVerboseBinaryRecords(input, &fileHeader, &records);
+	fclose(input);
+	if (!success) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s.\n", __FILE__, __LINE__, binaryFile);
+		return 1;
+	}
+
+	FILE *output = fopen(xmlFile, "w");
+	if (NULL == output) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create decoded verbose log %s.\n", __FILE__, __LINE__, xmlFile);
+		return 1;
+	}
+	printVerboseBinaryRecords(output, &fileHeader, records, false);
+	fclose(output);
+	gcTestEnv->log("Decoded %zu binary verbose records from %s.\n", records.size(), binaryFile);
+	return 0;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -810,6 +935,8 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	int32_t rt = 0;
 	uintptr_t seq = 1;
 	size_t numOfNode = verboseGCs.size();
+	const char *logToParse = verboseFile;
+	char decodedVerboseFile[MAX_NAME_LENGTH];
 	bool *isFound = (bool *)omrmem_allocate_memory(sizeof(int32_t) * numOfNode, OMRMEM_CATEGORY_MM);
 	if (NULL == isFound) {
 		rt = 1;
@@ -820,14 +947,25 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	if (env->getExtensions()->verboseBinaryLogging || env->getExtensions()->verboseAsyncLogging) {
+		/* these writers write from their own thread; stopping them flushes everything reported so far to the file */
+		verboseManager->closeStreams(env);
+	}
+	if (env->getExtensions()->verboseBinaryLogging) {
+		omrstr_printf(decodedVerboseFile, MAX_NAME_LENGTH, "%s.decoded", verboseFile);
+		rt = decodeBinaryVerboseLog(verboseFile, decodedVerboseFile);
+		OMRGCTEST_CHECK_RT(rt);
+		logToParse = decodedVerboseFile;
+	}
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
-			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
+			verboseDoc.load_file(logToParse);
+			gcTestEnv->log("Parsing verbose log %s:\n", logToParse);
 #if defined(OMRGCTEST_PRINTFILE)
-			printFile(verboseFile);
+			printFile(logToParse);
 #endif
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
@@ -895,6 +1033,10 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		}
 	}
 
+	if ((logToParse != verboseFile) && !gcTestEnv->keepLog) {
+		omrfile_unlink(logToParse);
+	}
+
 done:
 	omrmem_free_memory((void *)isFound);
 	return rt;
@@ -947,6 +1089,405 @@ done:
 	return rt;
 }
 
+typedef struct HeapWalkRecord {
+	volatile uintptr_t count; /**< objects visited so far */
+	uintptr_t capacity; /**< size of objects, 0 to only count */
+	omrobjectptr_t *objects; /**< visited objects, in no particular order */
+} HeapWalkRecord;
+
+static void
+heapWalkRecordObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *userData)
+{
+	HeapWalkRecord *record = (HeapWalkRecord *)userData;
+	uintptr_t index = MM_AtomicOperations::add(&record->count, 1) - 1;
+	if (index < record->capacity) {
+		record->objects[index] = object;
+	}
+}
+
+static int
+compareObjects(const void *left, const void *right)
+{
+	uintptr_t leftObject = (uintptr_t)*(omrobjectptr_t *)left;
+	uintptr_t rightObject = (uintptr_t)*(omrobjectptr_t *)right;
+	return (leftObject < rightObject) ? -1 : ((leftObject > rightObject) ? 1 : 0);
+}
+
+int32_t
+GCConfigTest::walkHeap()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	int32_t rt = 0;
+	HeapWalkRecord record = { 0, 0, NULL };
+	J9HashTableState state;
+	RootEntry *rootEntry = NULL;
+
+	/* count the objects first, then walk again to record them: nothing can move in between */
+	gcTestEnv->log("Invoking heap walk...\n");
+	rt = (int32_t)OMR_GC_WalkHeap(exampleVM->_omrVMThread, heapWalkRecordObject, (void *)&record);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WalkHeap with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	record.capacity = record.count;
+	record.count = 0;
+	record.objects = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * (record.capacity + 1), OMRMEM_CATEGORY_MM);
+	if (NULL == record.objects) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		rt = 1;
+		goto done;
+	}
+	rt = (int32_t)OMR_GC_WalkHeap(exampleVM->_omrVMThread, heapWalkRecordObject, (void *)&record);
+	OMRGCTEST_CHECK_RT(rt);
+	if (record.count != record.capacity) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walks visited %zu and %zu objects.\n", __FILE__, __LINE__, (size_t)record.capacity, (size_t)record.count);
+		rt = 1;
+		goto done;
+	}
+	gcTestEnv->log("Heap walk visited %zu objects\n", (size_t)record.count);
+
+	/* every object must be visited exactly once, and every root object must be visited */
+	qsort(record.objects, record.count, sizeof(omrobjectptr_t), compareObjects);
+	for (uintptr_t i = 1; i < record.count; i++) {
+		if (record.objects[i - 1] == record.objects[i]) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk visited object %p twice.\n", __FILE__, __LINE__, record.objects[i]);
+			rt = 1;
+			goto done;
+		}
+	}
+	rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		if (NULL == bsearch(&rootEntry->rootPtr, record.objects, record.count, sizeof(omrobjectptr_t), compareObjects)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk did not visit root object %s (%p).\n", __FILE__, __LINE__, rootEntry->name, rootEntry->rootPtr);
+			rt = 1;
+			goto done;
+		}
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+
+done:
+	if (NULL != record.objects) {
+		omrmem_free_memory(record.objects);
+	}
+	return rt;
+}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+/* MM_ParallelGlobalGC::fixHeapForWalk() passes its own object counter as the user data, so the record is passed aside */
+static HeapWalkRecord *fixHeapForWalkRecord = NULL;
+
+static void
+fixHeapForWalkRecordObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	heapWalkRecordObject(omrVMThread, object, (void *)fixHeapForWalkRecord);
+}
+#endif /* OMR_GC_MODRON_STANDARD */
+
+int32_t
+GCConfigTest::fixHeapForWalk()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	int32_t rt = 0;
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+	HeapWalkRecord fixed = { 0, 0, NULL };
+	HeapWalkRecord live = { 0, 0, NULL };
+
+	/* the fixup walk does not mark the heap, and may only split regions at mark bits left by a walk that did */
+	gcTestEnv->log("Invoking fix heap for walk...\n");
+	fixHeapForWalkRecord = &fixed;
+	env->acquireExclusiveVMAccess();
+	globalCollector->fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixHeapForWalkRecordObject);
+	fixed.capacity = fixed.count;
+	fixed.count = 0;
+	fixed.objects = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * (fixed.capacity + 1), OMRMEM_CATEGORY_MM);
+	if (NULL != fixed.objects) {
+		globalCollector->fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixHeapForWalkRecordObject);
+	}
+	env->releaseExclusiveVMAccess();
+	fixHeapForWalkRecord = NULL;
+	if (NULL == fixed.objects) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		rt = 1;
+		goto done;
+	}
+	if (fixed.count != fixed.capacity) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Fix heap for walk visited %zu and %zu objects.\n", __FILE__, __LINE__, (size_t)fixed.capacity, (size_t)fixed.count);
+		rt = 1;
+		goto done;
+	}
+
+	rt = (int32_t)OMR_GC_WalkHeap(exampleVM->_omrVMThread, heapWalkRecordObject, (void *)&live);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WalkHeap with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	live.capacity = live.count;
+	live.count = 0;
+	live.objects = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * (live.capacity + 1), OMRMEM_CATEGORY_MM);
+	if (NULL == live.objects) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		rt = 1;
+		goto done;
+	}
+	rt = (int32_t)OMR_GC_WalkHeap(exampleVM->_omrVMThread, heapWalkRecordObject, (void *)&live);
+	OMRGCTEST_CHECK_RT(rt);
+
+	/* the fixup walk also visits objects that died since the last collection, but must visit each object once,
+	 * and every live object */
+	qsort(fixed.objects, fixed.count, sizeof(omrobjectptr_t), compareObjects);
+	for (uintptr_t i = 1; i < fixed.count; i++) {
+		if (fixed.objects[i - 1] == fixed.objects[i]) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Fix heap for walk visited object %p twice.\n", __FILE__, __LINE__, fixed.objects[i]);
+			rt = 1;
+			goto done;
+		}
+	}
+	for (uintptr_t i = 0; i < live.count; i++) {
+		if (NULL == bsearch(&live.objects[i], fixed.objects, fixed.count, sizeof(omrobjectptr_t), compareObjects)) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Fix heap for walk did not visit live object %p.\n", __FILE__, __LINE__, live.objects[i]);
+			rt = 1;
+			goto done;
+		}
+	}
+	gcTestEnv->log("Fix heap for walk visited %zu objects, %zu of them live\n", (size_t)fixed.count, (size_t)live.count);
+
+done:
+	if (NULL != fixed.objects) {
+		omrmem_free_memory(fixed.objects);
+	}
+	if (NULL != live.objects) {
+		omrmem_free_memory(live.objects);
+	}
+#else /* OMR_GC_MODRON_STANDARD */
+	gcTestEnv->log(LEVEL_ERROR, "%s:%d fixHeapForWalk requires OMR_GC_MODRON_STANDARD.\n", __FILE__, __LINE__);
+	rt = 1;
+#endif /* OMR_GC_MODRON_STANDARD */
+	return rt;
+}
+
+static void
+heapWalkCountObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *userData)
+{
+	MM_AtomicOperations::add((volatile uintptr_t *)userData, 1);
+}
+
+static int
+compareRetainedSizeObjects(const void *left, const void *right)
+{
+	uintptr_t leftObject = (uintptr_t)((OMR_GC_RetainedSize *)left)->object;
+	uintptr_t rightObject = (uintptr_t)((OMR_GC_RetainedSize *)right)->object;
+	return (leftObject < rightObject) ? -1 : ((leftObject > rightObject) ? 1 : 0);
+}
+
+typedef struct ReachabilityWalk {
+	OMR_GC_RetainedSize *objects; /**< every live object, sorted by address */
+	uintptr_t objectCount;
+	omrobjectptr_t excluded; /**< object the walk does not enter, or NULL */
+	uint8_t *visited;
+	uintptr_t *stack;
+	uintptr_t depth;
+	uintptr_t reached; /**< objects reached so far */
+	uintptr_t bytes; /**< bytes consumed by the objects reached */
+} ReachabilityWalk;
+
+static bool
+reachObject(ReachabilityWalk *walk, omrobjectptr_t object)
+{
+	if ((NULL != object) && (walk->excluded != object)) {
+		OMR_GC_RetainedSize key = { object, NULL, 0, 0 };
+		OMR_GC_RetainedSize *found = (OMR_GC_RetainedSize *)bsearch(&key, walk->objects, walk->objectCount, sizeof(OMR_GC_RetainedSize), compareRetainedSizeObjects);
+		if (NULL == found) {
+			return false;
+		}
+		uintptr_t index = found - walk->objects;
+		if (0 == walk->visited[index]) {
+			walk->visited[index] = 1;
+			walk->stack[walk->depth] = index;
+			walk->depth += 1;
+			walk->reached += 1;
+			walk->bytes += found->shallowSize;
+		}
+	}
+	return true;
+}
+
+/**
+ * Walk the object graph from the roots without entering walk->excluded.
+ * @return false if a reachable object is missing from walk->objects
+ */
+static bool
+walkReachableObjects(OMR_VM *omrVM, ReachabilityWalk *walk, omrobjectptr_t *roots, uintptr_t rootCount)
+{
+	memset(walk->visited, 0, walk->objectCount);
+	walk->depth = 0;
+	walk->reached = 0;
+	walk->bytes = 0;
+	for (uintptr_t i = 0; i < rootCount; i++) {
+		if (!reachObject(walk, roots[i])) {
+			return false;
+		}
+	}
+	while (0 < walk->depth) {
+		walk->depth -= 1;
+		GC_ObjectIterator objectIterator(omrVM, walk->objects[walk->stack[walk->depth]].object);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = objectIterator.nextSlot())) {
+			/* the iterator skips the data of leaf objects, so every referent has to be found among the objects */
+			if (!reachObject(walk, slotObject->readReferenceFromSlot())) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int32_t
+GCConfigTest::analyzeRetainedSizes()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	int32_t rt = 0;
+	volatile uintptr_t heapObjects = 0;
+	omrobjectptr_t *roots = NULL;
+	uintptr_t rootCount = 0;
+	OMR_GC_RetainedSize *results = NULL;
+	uintptr_t resultCount = 0;
+	OMR_GC_RetainedSize largest[8];
+	uintptr_t largestCount = sizeof(largest) / sizeof(largest[0]);
+	uintptr_t *childSizes = NULL;
+	uintptr_t liveBytes = 0;
+	uintptr_t rootDominatedBytes = 0;
+	ReachabilityWalk walk;
+	J9HashTableState state;
+	RootEntry *rootEntry = NULL;
+
+	memset(&walk, 0, sizeof(walk));
+	/* the heap walk also visits dead objects, so it bounds the number of live ones */
+	rt = (int32_t)OMR_GC_WalkHeap(exampleVM->_omrVMThread, heapWalkCountObject, (void *)&heapObjects);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_WalkHeap with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	roots = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * (hashTableGetCount(exampleVM->rootTable) + 1), OMRMEM_CATEGORY_MM);
+	results = (OMR_GC_RetainedSize *)omrmem_allocate_memory(sizeof(OMR_GC_RetainedSize) * (heapObjects + 1), OMRMEM_CATEGORY_MM);
+	childSizes = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * (heapObjects + 1), OMRMEM_CATEGORY_MM);
+	walk.visited = (uint8_t *)omrmem_allocate_memory(heapObjects + 1, OMRMEM_CATEGORY_MM);
+	walk.stack = (uintptr_t *)omrmem_allocate_memory(sizeof(uintptr_t) * (heapObjects + 1), OMRMEM_CATEGORY_MM);
+	if ((NULL == roots) || (NULL == results) || (NULL == childSizes) || (NULL == walk.visited) || (NULL == walk.stack)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+		rt = 1;
+		goto done;
+	}
+	rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		roots[rootCount] = rootEntry->rootPtr;
+		rootCount += 1;
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+
+	gcTestEnv->log("Invoking retained size analysis...\n");
+	resultCount = heapObjects + 1;
+	rt = (int32_t)OMR_GC_AnalyzeRetainedSizes(exampleVM->_omrVMThread, roots, rootCount, results, &resultCount);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_AnalyzeRetainedSizes with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	gcTestEnv->log("Retained size analysis found %zu live objects, the largest retains %zu bytes\n", (size_t)resultCount, (size_t)((0 < resultCount) ? results[0].retainedSize : 0));
+
+	/* a smaller result array must hold the head of the full one */
+	rt = (int32_t)OMR_GC_AnalyzeRetainedSizes(exampleVM->_omrVMThread, roots, rootCount, largest, &largestCount);
+	OMRGCTEST_CHECK_RT(rt);
+	if (largestCount != OMR_MIN(resultCount, sizeof(largest) / sizeof(largest[0]))) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Retained size analysis reported %zu of the largest objects.\n", __FILE__, __LINE__, (size_t)largestCount);
+		rt = 1;
+		goto done;
+	}
+	for (uintptr_t i = 0; i < largestCount; i++) {
+		if (largest[i].retainedSize != results[i].retainedSize) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %zu retains %zu bytes in the short result and %zu bytes in the full one.\n", __FILE__, __LINE__, (size_t)i, (size_t)largest[i].retainedSize, (size_t)results[i].retainedSize);
+			rt = 1;
+			goto done;
+		}
+	}
+
+	/* results come largest first, and the retained size of an object is its own size plus that of the objects it immediately dominates */
+	for (uintptr_t i = 0; i < resultCount; i++) {
+		if ((results[i].retainedSize < results[i].shallowSize) || ((0 < i) && (results[i - 1].retainedSize < results[i].retainedSize))) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p retains %zu bytes and consumes %zu bytes, at position %zu.\n", __FILE__, __LINE__, results[i].object, (size_t)results[i].retainedSize, (size_t)results[i].shallowSize, (size_t)i);
+			rt = 1;
+			goto done;
+		}
+		liveBytes += results[i].shallowSize;
+	}
+	qsort(results, resultCount, sizeof(OMR_GC_RetainedSize), compareRetainedSizeObjects);
+	memset(childSizes, 0, sizeof(uintptr_t) * resultCount);
+	for (uintptr_t i = 0; i < resultCount; i++) {
+		if (NULL == results[i].dominator) {
+			rootDominatedBytes += results[i].retainedSize;
+		} else {
+			OMR_GC_RetainedSize key = { results[i].dominator, NULL, 0, 0 };
+			OMR_GC_RetainedSize *dominator = (OMR_GC_RetainedSize *)bsearch(&key, results, resultCount, sizeof(OMR_GC_RetainedSize), compareRetainedSizeObjects);
+			if (NULL == dominator) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Dominator %p of object %p is not a live object.\n", __FILE__, __LINE__, results[i].dominator, results[i].object);
+				rt = 1;
+				goto done;
+			}
+			childSizes[dominator - results] += results[i].retainedSize;
+		}
+	}
+	for (uintptr_t i = 0; i < resultCount; i++) {
+		if (results[i].retainedSize != (results[i].shallowSize + childSizes[i])) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p retains %zu bytes, it consumes %zu bytes and the objects it dominates retain %zu bytes.\n", __FILE__, __LINE__, results[i].object, (size_t)results[i].retainedSize, (size_t)results[i].shallowSize, (size_t)childSizes[i]);
+			rt = 1;
+			goto done;
+		}
+	}
+	if (rootDominatedBytes != liveBytes) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The roots retain %zu bytes, live objects consume %zu bytes.\n", __FILE__, __LINE__, (size_t)rootDominatedBytes, (size_t)liveBytes);
+		rt = 1;
+		goto done;
+	}
+
+	/* the live objects are exactly those reachable from the roots */
+	walk.objects = results;
+	walk.objectCount = resultCount;
+	if (!walkReachableObjects(exampleVM->_omrVM, &walk, roots, rootCount) || (walk.reached != resultCount)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %zu of %zu live objects are reachable from the roots, or a reachable object is not live.\n", __FILE__, __LINE__, (size_t)walk.reached, (size_t)resultCount);
+		rt = 1;
+		goto done;
+	}
+
+	/* an object retains exactly what becomes unreachable without it */
+	for (uintptr_t i = 0; i < largestCount; i++) {
+		walk.excluded = largest[i].object;
+		walkReachableObjects(exampleVM->_omrVM, &walk, roots, rootCount);
+		if ((liveBytes - walk.bytes) != largest[i].retainedSize) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Object %p retains %zu bytes, %zu bytes are unreachable without it.\n", __FILE__, __LINE__, largest[i].object, (size_t)largest[i].retainedSize, (size_t)(liveBytes - walk.bytes));
+			rt = 1;
+			goto done;
+		}
+	}
+
+done:
+	if (NULL != roots) {
+		omrmem_free_memory(roots);
+	}
+	if (NULL != results) {
+		omrmem_free_memory(results);
+	}
+	if (NULL != childSizes) {
+		omrmem_free_memory(childSizes);
+	}
+	if (NULL != walk.visited) {
+		omrmem_free_memory(walk.visited);
+	}
+	if (NULL != walk.stack) {
+		omrmem_free_memory(walk.stack);
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -967,6 +1508,178 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			rt = walkHeap();
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "retainedSizes")) {
+			rt = analyzeRetainedSizes();
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "fixHeapForWalk")) {
+			rt = fixHeapForWalk();
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+done:
+	return rt;
+}
+
+ObjectEntry *
+GCConfigTest::findReferenceArray(const char *name, uintptr_t *slotCount)
+{
+	ObjectEntry *objEntry = find(name);
+	if (NULL == objEntry) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find object %s in hash table.\n", __FILE__, __LINE__, name);
+	} else if (objEntry->objPtr->isLeaf()) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: object %s(%p[0x%llx]) has no reference slots to mutate.\n", __FILE__, __LINE__, name, objEntry->objPtr, objEntry->objPtr->header.raw());
+		objEntry = NULL;
+	} else {
+		*slotCount = objEntry->objPtr->slotCount();
+	}
+	return objEntry;
+}
+
+int32_t
+GCConfigTest::copyArraySlots(pugi::xml_node node)
+{
+	int32_t rt = 1;
+	uintptr_t sourceSlotCount = 0;
+	uintptr_t destinationSlotCount = 0;
+
+	const char *sourceStr = node.attribute("source").value();
+	const char *destinationStr = node.attribute("destination").value();
+	if (0 == strcmp(destinationStr, "")) {
+		destinationStr = sourceStr;
+	}
+	int32_t sourceIndex = atoi(node.attribute("sourceIndex").value());
+	int32_t destinationIndex = atoi(node.attribute("destinationIndex").value());
+	const char *lengthStr = node.attribute("length").value();
+	const char *repeatStr = node.attribute("repeat").value();
+	if (0 == strcmp(repeatStr, "")) {
+		repeatStr = "1";
+	}
+	int32_t repeat = atoi(repeatStr);
+
+	/* no allocation happens while mutating, so these entry pointers stay valid */
+	ObjectEntry *sourceEntry = findReferenceArray(sourceStr, &sourceSlotCount);
+	ObjectEntry *destinationEntry = findReferenceArray(destinationStr, &destinationSlotCount);
+	if ((NULL == sourceEntry) || (NULL == destinationEntry)) {
+		goto done;
+	}
+
+	{
+		/* length defaults to the rest of the source array */
+		int32_t length = (0 == strcmp(lengthStr, "")) ? (int32_t)sourceSlotCount - sourceIndex : atoi(lengthStr);
+		if ((0 > sourceIndex) || (0 > destinationIndex) || (0 > length)
+			|| (((uintptr_t)sourceIndex + (uintptr_t)length) > sourceSlotCount)
+			|| (((uintptr_t)destinationIndex + (uintptr_t)length) > destinationSlotCount)
+		) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: arrayCopy of %d slots from %s[%d] (0x%llx slots) to %s[%d] (0x%llx slots) is out of bounds.\n",
+					__FILE__, __LINE__, length, sourceStr, sourceIndex, sourceSlotCount, destinationStr, destinationIndex, destinationSlotCount);
+			goto done;
+		}
+
+		gcTestEnv->log(LEVEL_VERBOSE, "Copy %d slots from %s[%d] to %s[%d] %d time(s).\n", length, sourceStr, sourceIndex, destinationStr, destinationIndex, repeat);
+		fomrobject_t *sourceSlots = (fomrobject_t *)sourceEntry->objPtr + 1 + sourceIndex;
+		fomrobject_t *destinationSlots = (fomrobject_t *)destinationEntry->objPtr + 1 + destinationIndex;
+		/* copy backwards when an overlapping range is shifted up, as memmove would */
+		bool backwards = (sourceEntry == destinationEntry) && (destinationIndex > sourceIndex);
+		for (int32_t r = 0; r < repeat; r++) {
+			for (int32_t i = 0; i < length; i++) {
+				int32_t offset = backwards ? (length - 1 - i) : i;
+				GC_SlotObject sourceSlot(exampleVM->_omrVM, sourceSlots + offset);
+				standardWriteBarrierStore(exampleVM->_omrVMThread, destinationEntry->objPtr, destinationSlots + offset, sourceSlot.readReferenceFromSlot());
+			}
+		}
+
+		/* keep later child attachments from overwriting the copied references */
+		if (destinationEntry->numOfRef < (destinationIndex + length)) {
+			destinationEntry->numOfRef = destinationIndex + length;
+		}
+	}
+
+	rt = 0;
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::overwriteArraySlots(pugi::xml_node node)
+{
+	int32_t rt = 1;
+	uintptr_t targetSlotCount = 0;
+	omrobjectptr_t valuePtr = NULL;
+
+	const char *targetStr = node.attribute("target").value();
+	const char *valueStr = node.attribute("value").value();
+	int32_t index = atoi(node.attribute("index").value());
+	const char *lengthStr = node.attribute("length").value();
+	if (0 == strcmp(lengthStr, "")) {
+		lengthStr = "1";
+	}
+	int32_t length = atoi(lengthStr);
+	const char *strideStr = node.attribute("stride").value();
+	if (0 == strcmp(strideStr, "")) {
+		strideStr = "1";
+	}
+	int32_t stride = atoi(strideStr);
+	const char *repeatStr = node.attribute("repeat").value();
+	if (0 == strcmp(repeatStr, "")) {
+		repeatStr = "1";
+	}
+	int32_t repeat = atoi(repeatStr);
+
+	/* value names an object to store, or "null" (the default) to clear the slots */
+	if ((0 != strcmp(valueStr, "")) && (0 != strcmp(valueStr, "null"))) {
+		ObjectEntry *valueEntry = find(valueStr);
+		if (NULL == valueEntry) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find object %s in hash table.\n", __FILE__, __LINE__, valueStr);
+			goto done;
+		}
+		valuePtr = valueEntry->objPtr;
+	}
+
+	{
+		ObjectEntry *targetEntry = findReferenceArray(targetStr, &targetSlotCount);
+		if (NULL == targetEntry) {
+			goto done;
+		}
+		if ((0 > index) || (0 >= length) || (0 >= stride)
+			|| (((uintptr_t)index + ((uintptr_t)length - 1) * (uintptr_t)stride) >= targetSlotCount)
+		) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: overwrite of %d slots with stride %d from %s[%d] (0x%llx slots) is out of bounds.\n",
+					__FILE__, __LINE__, length, stride, targetStr, index, targetSlotCount);
+			goto done;
+		}
+
+		gcTestEnv->log(LEVEL_VERBOSE, "Overwrite %d slots of %s from index %d with stride %d by %s %d time(s).\n", length, targetStr, index, stride, (NULL == valuePtr) ? "null" : valueStr, repeat);
+		fomrobject_t *targetSlots = (fomrobject_t *)targetEntry->objPtr + 1;
+		for (int32_t r = 0; r < repeat; r++) {
+			for (int32_t i = 0; i < length; i++) {
+				standardWriteBarrierStore(exampleVM->_omrVMThread, targetEntry->objPtr, targetSlots + index + (i * stride), valuePtr);
+			}
+		}
+	}
+
+	rt = 0;
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::triggerMutation(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	for (; node; node = node.next_sibling()) {
+		if (0 == strcmp(node.name(), "arrayCopy")) {
+			rt = copyArraySlots(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "overwrite")) {
+			rt = overwriteArraySlots(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: unrecognized mutation \"%s\".\n", __FILE__, __LINE__, node.name());
+			goto done;
 		}
 	}
 done:
@@ -979,6 +1692,9 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 	int32_t rt = 0;
 	if ((0 == strcmp(configStyle, "nor")) || (0 == strcmp(configStyle, ""))) {
 		xs.object = "object";
+		xs.array = "array";
+		xs.elementType = "elementType";
+		xs.length = "length";
 		xs.namePrefix = "namePrefix";
 		xs.type = "type";
 		xs.numOfFields = "numOfFields";
@@ -990,6 +1706,9 @@ GCConfigTest::iniXMLStr(const char *configStyle)
 		xs.structure = "structure";
 	} else if (0 == strcmp(configStyle, "min")) {
 		xs.object = "o";
+		xs.array = "a";
+		xs.elementType = "et";
+		xs.length = "len";
 		xs.namePrefix = "n";
 		xs.type = "t";
 		xs.numOfFields = "f";
@@ -1024,10 +1743,10 @@ TEST_P(GCConfigTest, test)
 			gcTestEnv->log("\n+++++++++++++++++++++++++++Allocation+++++++++++++++++++++++++++\n");
 			rt = parseGarbagePolicy(configChild.child(xs.garbagePolicy));
 			ASSERT_EQ(0, rt) << "Failed to parse garbage policy.";
-			pugi::xpath_node_set objects = configChild.select_nodes(xs.object);
 			int64_t startTime = omrtime_current_time_millis();
-			for (pugi::xpath_node_set::const_iterator it = objects.begin(); it != objects.end(); ++it) {
-				rt = allocationWalker(it->node());
+			/* objects and arrays are allocated in document order; other nodes are skipped by the walker */
+			for (pugi::xml_node allocationChild = configChild.first_child(); allocationChild; allocationChild = allocationChild.next_sibling()) {
+				rt = allocationWalker(allocationChild);
 				ASSERT_EQ(0, rt) << "Failed to perform allocation.";
 			}
 			gcTestEnv->log("Time elapsed in allocation: %lld ms\n", (omrtime_current_time_millis() - startTime));
@@ -1046,7 +1765,9 @@ TEST_P(GCConfigTest, test)
 			rt = triggerOperation(configChild.first_child());
 			ASSERT_EQ(0, rt) << "Failed to perform gc operation.";
 		} else if (0 == strcmp(configChild.name(), "mutation")) {
-			/*TODO*/
+			gcTestEnv->log("\n++++++++++++++++++++++++++++Mutation++++++++++++++++++++++++++++\n");
+			rt = triggerMutation(configChild.first_child());
+			ASSERT_EQ(0, rt) << "Failed to perform mutation.";
 		} else {
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
@@ -1058,3 +1779,6 @@ INSTANTIATE_TEST_CASE_P(gcFunctionalTest,GCConfigTest,
 
 INSTANTIATE_TEST_CASE_P(perfTest,GCConfigTest,
         ::testing::ValuesIn(perfTests));
+
+INSTANTIATE_TEST_CASE_P(gcBenchmark,GCConfigTest,
+        ::testing::ValuesIn(benchmarkTests));
@@ -58,6 +58,9 @@ typedef struct GarbagePolicy {
 
 typedef struct XmlStr {
 	const char *object;
+	const char *array;
+	const char *elementType;
+	const char *length;
 	const char *namePrefix;
 	const char *type;
 	const char *numOfFields;
@@ -94,10 +97,12 @@ protected:
 	void freeAttributeList(AttributeElem *root);
 	int32_t parseAttribute(AttributeElem **root, const char *attrStr);
 	OMRGCObjectType parseObjectType(pugi::xml_node node);
-	ObjectEntry *allocateHelper(const char *objName, uintptr_t size);
-	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size);
+	uintptr_t parseElementType(const char *elementTypeStr, ObjectFlags *objectFlags);
+	uintptr_t calculateObjectSize(int32_t numOfElements, uintptr_t elementSize);
+	ObjectEntry *allocateHelper(const char *objName, uintptr_t size, ObjectFlags objectFlags);
+	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size, ObjectFlags objectFlags);
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
-	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
+	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth, uintptr_t elementSize, ObjectFlags objectFlags);
 	int32_t insertGarbage();
 	int32_t attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry);
 	int32_t removeObjectFromRootTable(const char *name);
@@ -107,9 +112,17 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	int32_t decodeBinaryVerboseLog(const char *binaryFile, const char *xmlFile);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t walkHeap();
+	int32_t fixHeapForWalk();
+	int32_t analyzeRetainedSizes();
+	ObjectEntry *findReferenceArray(const char *name, uintptr_t *slotCount);
+	int32_t copyArraySlots(pugi::xml_node node);
+	int32_t overwriteArraySlots(pugi::xml_node node);
+	int32_t triggerMutation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrTest.h"
+#include "omrport.h"
+#include "omrthread.h"
+#include "thread_api.h"
+
+#include "AtomicOperations.hpp"
+#include "GCThreadBarrier.hpp"
+#include "gcTestHelpers.hpp"
+
+/* Barrier phases each thread goes through per run */
+#define BARRIER_TEST_PHASES 2000
+#define BARRIER_BENCHMARK_PHASES 20000
+
+enum BarrierKind {
+	BARRIER_ALL_RELEASE, /**< the last thread to arrive releases everyone, as synchronizeGCThreads */
+	BARRIER_MASTER_RELEASE, /**< thread 0 waits for everyone, runs alone, then releases, as synchronizeGCThreadsAndReleaseMaster */
+	BARRIER_MONITOR /**< a monitor wait and notify per phase, as synchronizeGCThreads used to be, for comparison */
+};
+
+struct BarrierTestData {
+	BarrierKind kind;
+	MM_GCThreadBarrier barrier;
+	omrthread_monitor_t monitor;
+	uint32_t threadCount;
+	uintptr_t phases;
+	volatile uintptr_t arrivals; /**< incremented by every thread once per phase, before it arrives */
+	volatile uintptr_t failures; /**< phases in which a thread saw arrivals outside the bounds the barrier guarantees */
+	volatile uintptr_t monitorCount;
+	volatile uintptr_t monitorIndex;
+};
+
+struct BarrierTestThread {
+	BarrierTestData *data;
+	uint32_t index;
+	omrthread_t thread;
+};
+
+static void
+monitorBarrier(BarrierTestData *data)
+{
+	omrthread_monitor_enter(data->monitor);
+	data->monitorCount += 1;
+	if (data->monitorCount == data->threadCount) {
+		data->monitorCount = 0;
+		data->monitorIndex += 1;
+		omrthread_monitor_notify_all(data->monitor);
+	} else {
+		uintptr_t index = data->monitorIndex;
+		do {
+			omrthread_monitor_wait(data->monitor);
+		} while (index == data->monitorIndex);
+	}
+	omrthread_monitor_exit(data->monitor);
+}
+
+static int J9THREAD_PROC
+barrierTestThread(void *entryArg)
+{
+	BarrierTestThread *thread = (BarrierTestThread *)entryArg;
+	BarrierTestData *data = thread->data;
+	uintptr_t spinLimit = UDATA_MAX;
+
+	for (uintptr_t phase = 0; phase < data->phases; phase++) {
+		MM_AtomicOperations::add(&data->arrivals, 1);
+		switch (data->kind) {
+		case BARRIER_ALL_RELEASE:
+			data->barrier.arriveAndWait(data->threadCount, &spinLimit);
+			break;
+		case BARRIER_MASTER_RELEASE:
+		{
+			uint32_t generation = data->barrier.getGeneration();
+			data->barrier.arrive();
+			if (0 == thread->index) {
+				data->barrier.waitForArrivals(data->threadCount, &spinLimit);
+				/* every other thread is held until the release */
+				if (data->arrivals != ((phase + 1) * data->threadCount)) {
+					MM_AtomicOperations::add(&data->failures, 1);
+				}
+				data->barrier.release();
+			} else {
+				data->barrier.waitForRelease(generation, &spinLimit);
+			}
+			break;
+		}
+		case BARRIER_MONITOR:
+			monitorBarrier(data);
+			break;
+		}
+
+		/* everyone arrived for this phase, and nobody can have arrived for the one after the next */
+		uintptr_t arrivals = data->arrivals;
+		if ((arrivals < ((phase + 1) * data->threadCount)) || (arrivals > ((phase + 2) * data->threadCount))) {
+			MM_AtomicOperations::add(&data->failures, 1);
+		}
+	}
+	return 0;
+}
+
+/**
+ * Run threadCount threads through phases barrier phases.
+ * @return the nanoseconds the run took, or 0 if the threads could not be started
+ */
+static uint64_t
+runBarrier(BarrierKind kind, uint32_t threadCount, uintptr_t phases, uintptr_t spinMaximum, uintptr_t *failures)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	uint64_t elapsed = 0;
+	BarrierTestData data;
+	data.kind = kind;
+	data.monitor = NULL;
+	data.threadCount = threadCount;
+	data.phases = phases;
+	data.arrivals = 0;
+	data.failures = 0;
+	data.monitorCount = 0;
+	data.monitorIndex = 0;
+	if (0 != omrthread_monitor_init_with_name(&data.monitor, 0, "GCThreadBarrierTest")) {
+		return 0;
+	}
+	data.barrier.initialize(data.monitor, spinMaximum);
+
+	BarrierTestThread *threads = (BarrierTestThread *)omrmem_allocate_memory(threadCount * sizeof(BarrierTestThread), OMRMEM_CATEGORY_MM);
+	if (NULL != threads) {
+		omrthread_attr_t attr = NULL;
+		omrthread_attr_init(&attr);
+		omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+
+		/* threads start suspended, so the clock only measures the barrier */
+		uint32_t started = 0;
+		for (; started < threadCount; started++) {
+			threads[started].data = &data;
+			threads[started].index = started;
+			if (J9THREAD_SUCCESS != omrthread_create_ex(&threads[started].thread, &attr, 1, barrierTestThread, &threads[started])) {
+				break;
+			}
+		}
+		omrthread_attr_destroy(&attr);
+
+		if (started == threadCount) {
+			uint64_t startTime = omrtime_nano_time();
+			for (uint32_t i = 0; i < threadCount; i++) {
+				omrthread_resume(threads[i].thread);
+			}
+			for (uint32_t i = 0; i < threadCount; i++) {
+				omrthread_join(threads[i].thread);
+			}
+			elapsed = OMR_MAX(omrtime_nano_time() - startTime, 1);
+		} else {
+			/* let the threads that did start finish on a barrier sized for them, rather than leak them */
+			data.threadCount = started;
+			for (uint32_t i = 0; i < started; i++) {
+				omrthread_resume(threads[i].thread);
+			}
+			for (uint32_t i = 0; i < started; i++) {
+				omrthread_join(threads[i].thread);
+			}
+		}
+		omrmem_free_memory(threads);
+	}
+
+	omrthread_monitor_destroy(data.monitor);
+	*failures = data.failures;
+	return elapsed;
+}
+
+static void
+verifyBarrier(BarrierKind kind, uint32_t threadCount, uintptr_t spinMaximum)
+{
+	uintptr_t failures = 0;
+	ASSERT_NE((uint64_t)0, runBarrier(kind, threadCount, BARRIER_TEST_PHASES, spinMaximum, &failures));
+	ASSERT_EQ((uintptr_t)0, failures);
+}
+
+TEST(gcFunctionalTestThreadBarrier, spinning)
+{
+	verifyBarrier(BARRIER_ALL_RELEASE, 8, 4096);
+	verifyBarrier(BARRIER_MASTER_RELEASE, 8, 4096);
+}
+
+TEST(gcFunctionalTestThreadBarrier, parking)
+{
+	verifyBarrier(BARRIER_ALL_RELEASE, 8, 0);
+	verifyBarrier(BARRIER_MASTER_RELEASE, 8, 0);
+}
+
+/**
+ * Barrier latency at 8, 64 and 256 threads, for the spinning and the parking barrier and the monitor it replaced.
+ * Not part of the functional run; results are logged at -logLevel=info.
+ */
+TEST(gcBarrierBenchmark, latency)
+{
+	const uint32_t threadCounts[] = {8, 64, 256};
+	const struct {
+		const char *name;
+		BarrierKind kind;
+		uintptr_t spinMaximum;
+	} variants[] = {
+		{"spin+park", BARRIER_ALL_RELEASE, 4096},
+		{"park", BARRIER_ALL_RELEASE, 0},
+		{"monitor", BARRIER_MONITOR, 0},
+	};
+
+	for (uintptr_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+		for (uintptr_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+			uintptr_t failures = 0;
+			uint64_t elapsed = runBarrier(variants[v].kind, threadCounts[t], BARRIER_BENCHMARK_PHASES, variants[v].spinMaximum, &failures);
+			ASSERT_NE((uint64_t)0, elapsed);
+			ASSERT_EQ((uintptr_t)0, failures);
+			gcTestEnv->log("%u threads, %s: %llu ns per barrier\n", threadCounts[t], variants[v].name, (unsigned long long)(elapsed / BARRIER_BENCHMARK_PHASES));
+		}
+	}
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrTest.h"
+
+#include "Math.hpp"
+#include "NonTemporalCopy.hpp"
+
+#define GUARD_SIZE ((uintptr_t)32)
+#define GUARD_BYTE ((uint8_t)0xA5)
+#define BUFFER_SIZE (GUARD_SIZE + NON_TEMPORAL_COPY_BLOCK_SIZE + (4 * NON_TEMPORAL_COPY_BLOCK_SIZE) + NON_TEMPORAL_COPY_BLOCK_SIZE + GUARD_SIZE)
+
+/**
+ * Copy size bytes between the given offsets into cache line aligned buffers, and check that every byte arrived
+ * and that nothing on either side of the destination was written.
+ */
+static void
+checkCopy(uintptr_t sourceOffset, uintptr_t destinationOffset, uintptr_t size)
+{
+	uint8_t sourceBuffer[BUFFER_SIZE + NON_TEMPORAL_COPY_BLOCK_SIZE];
+	uint8_t destinationBuffer[BUFFER_SIZE + NON_TEMPORAL_COPY_BLOCK_SIZE];
+	uint8_t *source = (uint8_t *)MM_Math::roundToCeiling(NON_TEMPORAL_COPY_BLOCK_SIZE, (uintptr_t)sourceBuffer);
+	uint8_t *destination = (uint8_t *)MM_Math::roundToCeiling(NON_TEMPORAL_COPY_BLOCK_SIZE, (uintptr_t)destinationBuffer);
+
+	for (uintptr_t i = 0; i < BUFFER_SIZE; i++) {
+		source[i] = (uint8_t)(i * 7 + 1);
+	}
+	memset(destination, GUARD_BYTE, BUFFER_SIZE);
+
+	uint8_t *dst = destination + GUARD_SIZE + destinationOffset;
+	const uint8_t *src = source + GUARD_SIZE + sourceOffset;
+	MM_NonTemporalCopy::copy(dst, src, size);
+
+	for (uintptr_t i = 0; i < size; i++) {
+		ASSERT_EQ(src[i], dst[i]) << "byte " << i << " of " << size << ", source offset " << sourceOffset << ", destination offset " << destinationOffset;
+	}
+	for (uint8_t *guard = destination; guard < dst; guard++) {
+		ASSERT_EQ(GUARD_BYTE, *guard) << "wrote before the destination, size " << size << ", destination offset " << destinationOffset;
+	}
+	for (uint8_t *guard = dst + size; guard < destination + BUFFER_SIZE; guard++) {
+		ASSERT_EQ(GUARD_BYTE, *guard) << "wrote past the destination, size " << size << ", destination offset " << destinationOffset;
+	}
+}
+
+TEST(gcFunctionalTestNonTemporalCopy, smallerThanBlock)
+{
+	/* everything is copied by the unaligned head and tail */
+	for (uintptr_t size = 0; size < NON_TEMPORAL_COPY_BLOCK_SIZE; size++) {
+		for (uintptr_t offset = 0; offset < 16; offset++) {
+			checkCopy(offset, offset, size);
+			checkCopy(0, offset, size);
+		}
+	}
+}
+
+TEST(gcFunctionalTestNonTemporalCopy, unalignedHeadAndTail)
+{
+	/* destinations from 16 byte aligned through every misalignment, with sizes that leave a partial head block, whole streamed blocks and a partial tail */
+	for (uintptr_t size = NON_TEMPORAL_COPY_BLOCK_SIZE; size <= (5 * NON_TEMPORAL_COPY_BLOCK_SIZE); size += 5) {
+		for (uintptr_t destinationOffset = 0; destinationOffset < 16; destinationOffset++) {
+			checkCopy(destinationOffset, destinationOffset, size);
+			checkCopy((destinationOffset + 3) % 16, destinationOffset, size);
+		}
+	}
+}
+
+TEST(gcFunctionalTestNonTemporalCopy, objectAligned)
+{
+	/* heap objects are 8 byte aligned and sized, so the head is either empty or a single 8 byte word */
+	for (uintptr_t size = 8; size <= (5 * NON_TEMPORAL_COPY_BLOCK_SIZE); size += 8) {
+		checkCopy(0, 0, size);
+		checkCopy(8, 8, size);
+		checkCopy(0, 8, size);
+		checkCopy(8, 0, size);
+	}
+}
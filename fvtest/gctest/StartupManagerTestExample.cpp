@@ -82,8 +82,73 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "heapHugePageSize")) {
+					extensions->heapHugePageSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->verboseBinaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asyncLogging")) {
+					extensions->verboseAsyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verboseAsyncBufferCount")) {
+					extensions->verboseAsyncBufferCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "verboseAsyncBufferSize")) {
+					extensions->verboseAsyncBufferSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "stallAsyncWriter")) {
+					extensions->fvtest_stallVerboseAsyncWriter = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verboseTaskPhaseTimes")) {
+					extensions->verboseTaskPhaseTimes = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhTargetRefreshInterval")) {
+					extensions->tlhTargetRefreshInterval = atoi(attr.value());
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "batchClearTLHNonTemporalThreshold")) {
+					extensions->batchClearTLHNonTemporalThreshold = atoi(attr.value()) * unitSize;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				} else if (0 == strcmp(attr.name(), "tlhPreZeroing")) {
+					extensions->tlhPreZeroing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verifyPreZeroedTLH")) {
+					extensions->fvtest_verifyPreZeroedTLH = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				} else if (0 == strcmp(attr.name(), "gcOnIdle")) {
+					extensions->gcOnIdle = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "idleHeapReleaseLazily")) {
+					extensions->idleHeapReleaseLazily = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "idleHeapReleaseSliceMicros")) {
+					extensions->idleHeapReleaseSliceMicros = atoi(attr.value());
+#else
+				} else if ((0 == strcmp(attr.name(), "gcOnIdle")) || (0 == strcmp(attr.name(), "idleHeapReleaseLazily")) || (0 == strcmp(attr.name(), "idleHeapReleaseSliceMicros"))) {
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: %s ignored, requires OMR_GC_IDLE_HEAP_MANAGER\n", attr.name());
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+				} else if (0 == strcmp(attr.name(), "heapCensusEnabled")) {
+					extensions->heapCensusEnabled = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "dominatorAnalysisMemoryLimit")) {
+					extensions->dominatorAnalysisMemoryLimit = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingWorkPerThread")) {
+					extensions->adaptiveGCThreadingWorkPerThread = atoi(attr.value());
+#if defined(OMR_GC_MODRON_SCAVENGER)
+				} else if (0 == strcmp(attr.name(), "scavengerNonTemporalCopyThreshold")) {
+					extensions->scavengerNonTemporalCopyThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerSurvivorAgeStreams")) {
+					extensions->scavengerSurvivorAgeStreams = atoi(attr.value());
+#else
+				} else if ((0 == strcmp(attr.name(), "scavengerNonTemporalCopyThreshold")) || (0 == strcmp(attr.name(), "scavengerSurvivorAgeStreams"))) {
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: %s ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n", attr.name());
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "markingEdgeMode")) {
+					extensions->markingEdgeMode = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDistance")) {
+					extensions->markingPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workpacketCount")) {
+					extensions->workpacketCount = atoi(attr.value());
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -100,6 +165,30 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecast")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentKickoffForecast = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentKickoffForecast ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentKickoffForecastSampleInterval")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentKickoffForecastSampleInterval = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentKickoffForecastSampleInterval ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: optimizeConcurrentWB ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentAssistPacing")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentAssistPacing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentAssistPacing ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
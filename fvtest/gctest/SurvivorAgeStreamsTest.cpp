@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrTest.h"
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "Scavenger.hpp"
+
+#define AGE_MASK(age) ((uintptr_t)1 << (age))
+/* ages from a tenure age up to OBJECT_HEADER_AGE_MAX, as calculateTenureMaskUsingFixed() builds them */
+#define FIXED_TENURE_MASK(tenureAge) ((AGE_MASK(OBJECT_HEADER_AGE_MAX + 1) - 1) & ~(AGE_MASK(tenureAge) - 1))
+
+/**
+ * Calculate the streams for tenureMask and compare them, age by age, with expected (OBJECT_HEADER_AGE_MAX + 1 entries).
+ */
+static void
+checkAgeStreams(uintptr_t tenureMask, uintptr_t streamCount, const uintptr_t *expected)
+{
+	uintptr_t ageStreams[OBJECT_HEADER_AGE_MAX + 1];
+	MM_Scavenger::calculateSurvivorAgeStreams(tenureMask, streamCount, ageStreams);
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		ASSERT_EQ(expected[age], ageStreams[age]) << "age " << age << ", tenure mask " << std::hex << tenureMask << ", " << std::dec << streamCount << " streams";
+	}
+}
+
+TEST(gcFunctionalTestSurvivorAgeStreams, singleStream)
+{
+	/* one stream is no grouping at all */
+	const uintptr_t expected[OBJECT_HEADER_AGE_MAX + 1] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	checkAgeStreams(AGE_MASK(OBJECT_HEADER_AGE_MAX), 1, expected);
+	checkAgeStreams(FIXED_TENURE_MASK(1), 1, expected);
+}
+
+TEST(gcFunctionalTestSurvivorAgeStreams, tenureAtMaximumAge)
+{
+	/* the youngest survivors, many scavenges from tenure, share the last stream */
+	const uintptr_t expected[OBJECT_HEADER_AGE_MAX + 1] = {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 1, 0};
+	checkAgeStreams(AGE_MASK(OBJECT_HEADER_AGE_MAX), SCAVENGER_SURVIVOR_AGE_STREAMS_MAX, expected);
+}
+
+TEST(gcFunctionalTestSurvivorAgeStreams, fixedTenureAge)
+{
+	/* ages at or above the tenure age are tenured at the next scavenge if they are flipped at all */
+	const uintptr_t expectedAge3[OBJECT_HEADER_AGE_MAX + 1] = {3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	checkAgeStreams(FIXED_TENURE_MASK(3), 4, expectedAge3);
+
+	const uintptr_t expectedAge10[OBJECT_HEADER_AGE_MAX + 1] = {2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 0, 0};
+	checkAgeStreams(FIXED_TENURE_MASK(10), 3, expectedAge10);
+
+	const uintptr_t expectedAge1[OBJECT_HEADER_AGE_MAX + 1] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	checkAgeStreams(FIXED_TENURE_MASK(1), 2, expectedAge1);
+}
+
+TEST(gcFunctionalTestSurvivorAgeStreams, sparseTenureMask)
+{
+	/* masks from survival history need not be contiguous; the count restarts below each tenured age */
+	const uintptr_t expected[OBJECT_HEADER_AGE_MAX + 1] = {3, 3, 3, 2, 1, 0, 3, 3, 3, 3, 3, 3, 2, 1, 0};
+	checkAgeStreams(AGE_MASK(5) | AGE_MASK(OBJECT_HEADER_AGE_MAX), 4, expected);
+
+	const uintptr_t expectedAlternate[OBJECT_HEADER_AGE_MAX + 1] = {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0};
+	checkAgeStreams(0x5555 & (AGE_MASK(OBJECT_HEADER_AGE_MAX + 1) - 1), 4, expectedAlternate);
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
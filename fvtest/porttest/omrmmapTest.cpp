@@ -135,6 +135,10 @@ TEST_F(PortMmapTest, mmap_test0)
 		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->mmap_get_region_granularity is NULL\n");
 	}
 
+	if (NULL == OMRPORTLIB->mmap_dont_need_ex) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "portLibrary->mmap_dont_need_ex is NULL\n");
+	}
+
 	reportTestExit(OMRPORTLIB, testName);
 }
 
@@ -2180,6 +2184,59 @@ TEST_F(PortMmapTest, mmap_testDontNeed)
 	reportTestExit(OMRPORTLIB, testName);
 }
 
+/**
+ * Verify that pages disclaimed through omrmmap_dont_need_ex stay usable, and read as zero when reported so.
+ */
+TEST_F(PortMmapTest, mmap_testDontNeedEx)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrmmap_testDontNeedEx";
+	uintptr_t flagsToTest[] = {0, OMRPORT_MMAP_DONT_NEED_LAZY};
+
+	reportTestEntry(OMRPORTLIB, testName);
+	for (uintptr_t i = 0; i < sizeof(flagsToTest) / sizeof(flagsToTest[0]); i++) {
+		uint32_t *testData = (uint32_t *)omrmem_allocate_memory(TEST_BUFF_LEN * sizeof(uint32_t), OMRMEM_CATEGORY_PORT_LIBRARY);
+		if (NULL == testData) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "memory allocation failed\n");
+			break;
+		}
+		for (uint32_t cursor = 0; cursor < TEST_BUFF_LEN; ++cursor) {
+			testData[cursor] = 3 * cursor;
+		}
+		uintptr_t pageSize = omrmmap_get_region_granularity(testData);
+		uint32_t *releaseBase = testData;
+		uint32_t *releaseTop = testData;
+		if (0 != pageSize) {
+			releaseBase = (uint32_t *)(((uintptr_t)testData + pageSize - 1) & ~(pageSize - 1));
+			releaseTop = (uint32_t *)(((uintptr_t)(testData + TEST_BUFF_LEN)) & ~(pageSize - 1));
+		}
+		if (releaseBase < releaseTop) {
+			int32_t rc = omrmmap_dont_need_ex(releaseBase, (uintptr_t)releaseTop - (uintptr_t)releaseBase, flagsToTest[i]);
+			for (uint32_t cursor = 0; cursor < TEST_BUFF_LEN; ++cursor) {
+				uint32_t *slot = testData + cursor;
+				bool released = (slot >= releaseBase) && (slot < releaseTop);
+				if (released && (OMRPORT_MMAP_DONT_NEED_ZEROED == rc)) {
+					if (0 != *slot) {
+						outputErrorMessage(PORTTEST_ERROR_ARGS, "Released page not zeroed at index %d\n", cursor);
+						break;
+					}
+				} else if (!released || (OMRPORT_MMAP_DONT_NEED_NOT_RELEASED == rc)) {
+					if (3 * cursor != *slot) {
+						outputErrorMessage(PORTTEST_ERROR_ARGS, "Test buffer corrupted at index %d\n", cursor);
+						break;
+					}
+				}
+			}
+			/* the released pages must remain writable */
+			for (uint32_t *slot = releaseBase; slot < releaseTop; slot++) {
+				*slot = 1;
+			}
+		}
+		omrmem_free_memory(testData);
+	}
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 int32_t
 omrmmap_runTests(struct OMRPortLibrary *portLibrary, char *argv0, char *omrmmap_child)
 {
@@ -26,6 +26,7 @@
 #include "CompactDelegate.hpp"
 
 #include "CompactScheme.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "omr.h"
 #include "omrcfg.h"
@@ -33,6 +34,7 @@
 #include "SublistPuddle.hpp"
 #include "SublistPool.hpp"
 #include "SublistIterator.hpp"
+#include "Task.hpp"
 #include <iostream>
 
 namespace OMR
@@ -42,30 +44,69 @@ namespace GC
 
 void
 CompactDelegate::fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) {
-    auto &cx = getContext(env);
+    auto &system = getSystem(env);
 
     CompactingVisitor visitor(_compactScheme);
 
+    // Every GC thread walks the same sequence of work units; each unit is claimed by exactly one thread.
+
     /// System-wide roots
 
-    for (auto &fn : cx.system().compactingFns()) {
-        fn(visitor);
+    if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+        for (auto &fn : system.compactingFns()) {
+            fn(visitor);
+        }
+
+        for (auto &roots : system.rootSets()) {
+            roots->scan(visitor);
+        }
+
+        for (const RootRange &range : system.rootRanges()) {
+            fixupRootRange(visitor, range);
+        }
     }
 
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
-    fixupRememberedSet(env, compactScheme);
+    if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+        fixupRememberedSet(env, compactScheme);
+    }
 #endif // OMR_GC_MODRON_SCAVENGER
 
-    /// Per-context roots
+    /// Per-context roots, one work unit per context
+
+    for (Context &cx : system.contexts()) {
+        if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+            for (StackRootListNode &node : cx.stackRoots()) {
+                visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)&node.ref));
+            }
+
+            cx.shadowStack().forEachSlot([&](void **slot) {
+                visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)slot));
+            });
 
-    // Note: only scanning the stack roots for *one* context.
-    for (StackRootListNode &node : cx.stackRoots()) {
-        visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)&node.ref));
+            for (auto &fn : cx.compactingFns()) {
+                fn(visitor);
+            }
+
+            for (auto &roots : cx.rootSets()) {
+                roots->scan(visitor);
+            }
+
+            for (const RootRange &range : cx.rootRanges()) {
+                fixupRootRange(visitor, range);
+            }
+        }
     }
+}
 
-    for (auto &fn : cx.compactingFns()) {
-        fn(visitor);
+void
+CompactDelegate::fixupRootRange(CompactingVisitor &visitor, const RootRange &range) {
+    void **end = range.base + range.count;
+    for (void **slot = range.base; slot < end; slot++) {
+        if (*slot) {
+            visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)slot));
+        }
     }
 }
 
@@ -57,6 +57,9 @@ public:
 	 * Function members
 	 */
 private:
+	/// Fixup every slot of a contiguous root table.
+	void
+	fixupRootRange(CompactingVisitor &visitor, const RootRange &range);
 
 protected:
 
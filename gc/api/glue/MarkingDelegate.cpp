@@ -23,6 +23,7 @@
 #include <OMR/GC/StackRoot.hpp>
 #include <OMR/GC/System.hpp>
 
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "MarkingScheme.hpp"
 #include "omr.h"
@@ -30,6 +31,7 @@
 #include "omrhashtable.h"
 #include "SublistSlotIterator.hpp"
 #include "SublistIterator.hpp"
+#include "Task.hpp"
 #include <iostream>
 
 namespace OMR
@@ -40,35 +42,73 @@ namespace GC
 void
 MarkingDelegate::scanRoots(MM_EnvironmentBase *env)
 {
-	auto &cx = getContext(env);
+	auto &system = getSystem(env);
 	MM_MarkingScheme::MarkingVisitor marker(env, _markingScheme);
 
+	// Every GC thread walks the same sequence of work units; each unit is claimed by exactly one thread.
+
 	/// System-wide roots
 
-	for (auto &fn : cx.system().markingFns()) {
-		fn(marker);
-	}
+	if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		for (auto &fn : system.markingFns()) {
+			fn(marker);
+		}
 
-	/// Per-context roots
+		for (auto &roots : system.rootSets()) {
+			roots->scan(marker);
+		}
 
-	// Note: only scanning the stack roots for *one* context.
-	for (const StackRootListNode &node : cx.stackRoots()) {
-		_markingScheme->markObject(env, omrobjectptr_t(node.ref));
+		for (const RootRange &range : system.rootRanges()) {
+			scanRootRange(env, range);
+		}
 	}
 
-	for (auto &fn : cx.markingFns()) {
-		fn(marker);
+	/// Per-context roots, one work unit per context
+
+	for (Context &cx : system.contexts()) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			for (const StackRootListNode &node : cx.stackRoots()) {
+				_markingScheme->markObject(env, omrobjectptr_t(node.ref));
+			}
+
+			cx.shadowStack().forEachSlot([&](void **slot) {
+				_markingScheme->markObject(env, omrobjectptr_t(*slot));
+			});
+
+			for (auto &fn : cx.markingFns()) {
+				fn(marker);
+			}
+
+			for (auto &roots : cx.rootSets()) {
+				roots->scan(marker);
+			}
+
+			for (const RootRange &range : cx.rootRanges()) {
+				scanRootRange(env, range);
+			}
+		}
 	}
+}
 
-	// gc builtins
+void
+MarkingDelegate::scanRootRange(MM_EnvironmentBase *env, const RootRange &range)
+{
+	void **end = range.base + range.count;
+	for (void **slot = range.base; slot < end; slot++) {
+		_markingScheme->markObject(env, omrobjectptr_t(*slot));
+	}
+}
 
-#if defined (OMR_GC_MODRON_SCAVENGER)
-	{
-		MM_SublistPuddle *puddle;
-		omrobjectptr_t *slot;
-		GC_SublistIterator rememberedSetIterator(&env->getExtensions()->rememberedSet);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MarkingDelegate::pruneRememberedSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle;
+	omrobjectptr_t *slot;
+	GC_SublistIterator rememberedSetIterator(&env->getExtensions()->rememberedSet);
 
-		while((puddle = rememberedSetIterator.nextList()) != NULL) {
+	while((puddle = rememberedSetIterator.nextList()) != NULL) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
 			while((slot = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot()) != NULL) {
 				omrobjectptr_t object = *slot;
@@ -81,9 +121,8 @@ MarkingDelegate::scanRoots(MM_EnvironmentBase *env)
 			}
 		}
 	}
-#endif
-
 }
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 void
 MarkingDelegate::masterCleanupAfterGC(MM_EnvironmentBase *env)
@@ -38,6 +38,8 @@ namespace OMR
 namespace GC
 {
 
+struct RootRange;
+
 /**
  * Provides language-specific support for marking.
  */
@@ -56,6 +58,19 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Mark every object referenced from a contiguous root table.
+	 */
+	void scanRootRange(MM_EnvironmentBase *env, const RootRange &range);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Remove dead and null entries from the remembered set. Must only be called once marking is
+	 * complete, so that isMarked() is final. Each puddle is a work unit, shared across all GC threads.
+	 */
+	void pruneRememberedSet(MM_EnvironmentBase *env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 protected:
 public:
 	/**
@@ -129,6 +144,10 @@ public:
 	 */
 	MMINLINE void workerCompleteGC(MM_EnvironmentBase *env)
 	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		pruneRememberedSet(env);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 		/* All threads flush buffers before this point, and complete any remaining
 		 * language-specific marking tasks */
 		if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
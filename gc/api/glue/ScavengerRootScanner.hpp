@@ -27,10 +27,12 @@
 #include "omrhashtable.h"
 
 #include "Base.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
 #include "Scavenger.hpp"
 #include "SublistFragment.hpp"
+#include "Task.hpp"
 #include "OMR/GC/StackRoot.hpp"
 #include "OMR/GC/System.hpp"
 #include "OMR/GC/RefSlotHandle.hpp"
@@ -55,6 +57,17 @@ public:
 	 * Member functions
 	 */
 private:
+	void
+	scanRootRange(ScavengingRootVisitor &visitor, const RootRange &range)
+	{
+		void **end = range.base + range.count;
+		for (void **slot = range.base; slot < end; slot++) {
+			if (NULL != *slot) {
+				visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)slot));
+			}
+		}
+	}
+
 protected:
 public:
 	ScavengerRootScanner(MM_EnvironmentBase *env, MM_Scavenger *scavenger)
@@ -79,24 +92,56 @@ public:
 	void
 	scanRoots(MM_EnvironmentStandard *env)
 	{
-		auto &cx = getContext(env);
+		auto &system = getSystem(env);
 		ScavengingRootVisitor visitor(env, _scavenger);
 
+		// Every GC thread walks the same sequence of work units; each unit is claimed by exactly one thread.
+
 		/// System-wide roots
 
-		for (auto &fn : cx.system().scavengingFns()) {
-			fn(visitor);
-		}
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			for (auto &fn : system.scavengingFns()) {
+				fn(visitor);
+			}
 
-		/// Per-context roots
+			for (auto &roots : system.rootSets()) {
+				roots->scan(visitor);
+			}
 
-		// Note: only scanning the stack roots for *one* context.
-		for (StackRootListNode &node : cx.stackRoots()) {
-			visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)&node.ref));
+			for (const RootRange &range : system.rootRanges()) {
+				scanRootRange(visitor, range);
+			}
 		}
 
-		for (auto &fn : cx.scavengingFns()) {
-			fn(visitor);
+		/// Per-context roots, one work unit per context
+
+		for (Context &cx : system.contexts()) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				// The scavenger does not expect null referents, and would overwrite the slot.
+				for (StackRootListNode &node : cx.stackRoots()) {
+					if (NULL != node.ref) {
+						visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)&node.ref));
+					}
+				}
+
+				cx.shadowStack().forEachSlot([&](void **slot) {
+					if (NULL != *slot) {
+						visitor.edge(NULL, RefSlotHandle((omrobjectptr_t*)slot));
+					}
+				});
+
+				for (auto &fn : cx.scavengingFns()) {
+					fn(visitor);
+				}
+
+				for (auto &roots : cx.rootSets()) {
+					roots->scan(visitor);
+				}
+
+				for (const RootRange &range : cx.rootRanges()) {
+					scanRootRange(visitor, range);
+				}
+			}
 		}
 	}
 
@@ -27,7 +27,8 @@
 
 #include "objectdescription.h"
 
-#include <cassert>
+#include "AtomicSupport.hpp"
+
 #include <cstdint>
 #include <cstdlib>
 
@@ -52,7 +53,11 @@ public:
 		*_slot = CompressedRef(std::uint64_t(value) >> _shift);
 	}
 
-	void atomicWriteReference(omrobjectptr_t value) const noexcept { assert(0); }
+	/// As for RefSlotHandle, a single aligned 32-bit store after a write barrier.
+	void atomicWriteReference(omrobjectptr_t value) const noexcept {
+		VM_AtomicSupport::writeBarrier();
+		*(volatile CompressedRef *)_slot = CompressedRef(std::uint64_t(value) >> _shift);
+	}
 
 private:
 	CompressedRef *_slot;
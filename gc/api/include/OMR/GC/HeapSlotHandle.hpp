@@ -0,0 +1,61 @@
+/*******************************************************************************
+ *  Copyright (c) 2018, 2018 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_HEAPSLOTHANDLE_HPP_)
+#define OMR_GC_HEAPSLOTHANDLE_HPP_
+
+#include "omrcfg.h"
+
+#include "objectdescription.h"
+
+#include <OMR/GC/CompressedRefSlotHandle.hpp>
+#include <OMR/GC/RefSlotHandle.hpp>
+
+#include <cstdlib>
+
+namespace OMR {
+namespace GC {
+
+/// A handle to a reference slot inside a heap object. Heap slots are fomrobject_t wide, so when
+/// OMR_GC_COMPRESSED_POINTERS is defined they hold a reference shifted right by the run-time
+/// compressed pointers shift (OMR_VM::_compressedPointersShift), and otherwise a full pointer.
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+using HeapSlotHandle = CompressedRefSlotHandle;
+#else /* OMR_GC_COMPRESSED_POINTERS */
+using HeapSlotHandle = RefSlotHandle;
+#endif /* OMR_GC_COMPRESSED_POINTERS */
+
+/// Make a handle to the heap slot at `slot`. The shift is ignored in full-width builds.
+inline HeapSlotHandle
+makeHeapSlotHandle(fomrobject_t *slot, std::size_t compressedPointersShift)
+{
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+	return HeapSlotHandle(slot, compressedPointersShift);
+#else /* OMR_GC_COMPRESSED_POINTERS */
+	return HeapSlotHandle((omrobjectptr_t *)slot);
+#endif /* OMR_GC_COMPRESSED_POINTERS */
+}
+
+}  // namespace GC
+}  // namespace OMR
+
+#endif // OMR_GC_HEAPSLOTHANDLE_HPP_
@@ -26,17 +26,15 @@
 #include "objectdescription.h"
 #include "omrcfg.h"
 
-#include <cassert>
-
-#if defined(OMR_GC_COMPRESSED_POINTERS)
-#error "RefSlotHandle is incompatible with compressed pointers, use CompressedRefSlotHandle"
-#endif // OMR_GC_COMPRESSED_POINTERS
+#include "AtomicSupport.hpp"
 
 namespace OMR
 {
 namespace GC
 {
 
+/// A handle to a slot containing a full-width reference. Roots are always full width, so this
+/// handle is valid in compressed builds too; heap slots should be reached through HeapSlotHandle.
 class RefSlotHandle
 {
 public:
@@ -48,7 +46,12 @@ public:
 
 	void writeReference(omrobjectptr_t value) const noexcept { *_slot = value; }
 
-	void atomicWriteReference(omrobjectptr_t value) const noexcept { assert(0); }
+	/// An aligned word store is single-copy atomic; the barrier orders the stores that initialized
+	/// the referent before the store that publishes it.
+	void atomicWriteReference(omrobjectptr_t value) const noexcept {
+		VM_AtomicSupport::writeBarrier();
+		*(omrobjectptr_t volatile *)_slot = value;
+	}
 
 private:
 	omrobjectptr_t *_slot;
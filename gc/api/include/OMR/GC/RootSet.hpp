@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *  Copyright (c) 2018, 2018 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_ROOTSET_HPP_)
+#define OMR_GC_ROOTSET_HPP_
+
+#include <OMR/GC/MarkingFn.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class CompactingVisitor;
+class ScavengingRootVisitor;
+
+namespace OMR
+{
+namespace GC
+{
+
+/// A contiguous table of `count` reference slots, starting at `base`.
+/// Root ranges are scanned directly by every collector, with no callback per slot. Null slots are ignored.
+struct RootRange
+{
+	void** base;
+	std::size_t count;
+};
+
+using RootRangeVector = std::vector<RootRange>;
+
+/// A registered set of roots, dispatched once per collection.
+/// Users do not subclass RootSet directly; see StaticRootSet.hpp.
+class RootSet
+{
+public:
+	virtual ~RootSet() = default;
+
+	virtual void scan(MarkingVisitor& visitor) = 0;
+
+	virtual void scan(ScavengingRootVisitor& visitor) = 0;
+
+	virtual void scan(CompactingVisitor& visitor) = 0;
+};
+
+using RootSetVector = std::vector<std::unique_ptr<RootSet>>;
+
+} // namespace GC
+} // namespace OMR
+
+#endif // OMR_GC_ROOTSET_HPP_
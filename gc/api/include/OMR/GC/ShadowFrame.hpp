@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *  Copyright (c) 2018, 2018 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_SHADOWFRAME_HPP_)
+#define OMR_GC_SHADOWFRAME_HPP_
+
+#include <OMR/GC/Handle.hpp>
+#include <OMR/GC/ShadowStack.hpp>
+#include <OMR/GC/System.hpp>
+
+#include <cassert>
+#include <cstddef>
+
+namespace OMR
+{
+namespace GC
+{
+
+/// A frame of `size` contiguous roots, reserved on a ShadowStack at construction and released at destruction.
+/// All slots start out null. Like StackRoots, ShadowFrames must be stack allocated and have a strict LIFO lifetime.
+///
+/// Where a StackRoot links one node per root, a ShadowFrame roots all of a call's references with one bump of the
+/// stack's top pointer, and the GC scans the slots as a dense array.
+class ShadowFrame
+{
+public:
+	/// ShadowFrames must be stack allocated, so the new operator is explicitly removed.
+	void* operator new(std::size_t) = delete;
+
+	ShadowFrame(ShadowStack& stack, std::size_t size)
+	        : _stack(stack), _slots(stack.reserve(size)), _size(size)
+	{}
+
+	/// Reserve a new frame on the context's shadowStack.
+	ShadowFrame(Context& cx, std::size_t size) : ShadowFrame(cx.shadowStack(), size) {}
+
+	ShadowFrame(const ShadowFrame&) = delete;
+
+	~ShadowFrame() noexcept { _stack.release(_slots); }
+
+	std::size_t size() const noexcept { return _size; }
+
+	/// The untyped reference slot at `index`.
+	void*& operator[](std::size_t index) noexcept
+	{
+		assert(index < _size);
+		return _slots[index];
+	}
+
+	template<typename T>
+	T* get(std::size_t index) const noexcept
+	{
+		assert(index < _size);
+		return static_cast<T*>(_slots[index]);
+	}
+
+	template<typename T>
+	void set(std::size_t index, T* ref) noexcept
+	{
+		assert(index < _size);
+		_slots[index] = ref;
+	}
+
+	/// A Handle through the slot at `index`, valid until the frame is destroyed.
+	template<typename T>
+	Handle<T> handle(std::size_t index) const noexcept
+	{
+		assert(index < _size);
+		return Handle<T>(reinterpret_cast<RawHandle<T>>(&_slots[index]));
+	}
+
+	/// The address of the first slot in this frame.
+	void** slots() const noexcept { return _slots; }
+
+	ShadowStack& stack() const noexcept { return _stack; }
+
+private:
+	ShadowStack& _stack;
+	void** _slots;
+	std::size_t _size;
+};
+
+} // namespace GC
+} // namespace OMR
+
+#endif // OMR_GC_SHADOWFRAME_HPP_
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *  Copyright (c) 2018, 2018 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_SHADOWSTACK_HPP_)
+#define OMR_GC_SHADOWSTACK_HPP_
+
+#include <cassert>
+#include <cstddef>
+
+namespace OMR
+{
+namespace GC
+{
+
+/// A contiguous run of root slots in a ShadowStack. Slots [base, top) are live.
+struct ShadowStackSegment
+{
+	ShadowStackSegment(std::size_t capacity)
+	        : prev(nullptr), next(nullptr), base(new void*[capacity]), top(base), limit(base + capacity)
+	{}
+
+	~ShadowStackSegment() { delete[] base; }
+
+	std::size_t capacity() const noexcept { return limit - base; }
+
+	bool contains(void** slot) const noexcept { return (base <= slot) && (slot <= top); }
+
+	ShadowStackSegment* prev;
+	ShadowStackSegment* next;
+	void** base;
+	void** top;
+	void** limit;
+};
+
+/// The ShadowStack is an untyped stack of rooted, untagged pointers, stored as dense arrays of slots.
+///
+/// Roots are reserved and released a frame at a time, in strict LIFO order. Reserving a frame is a bump of the top
+/// pointer, so an interpreter can root all of a call's references with a single reservation. A frame never spans two
+/// segments, so the slots of a frame are contiguous and their addresses are stable for the frame's lifetime. Segments
+/// are retained when frames are released, so a steady state call depth allocates nothing.
+///
+/// The GC scans each segment as a flat array. Users should not normally use the ShadowStack directly, instead
+/// reserve roots with a ShadowFrame.
+class ShadowStack
+{
+public:
+	/// The number of slots in each segment, unless a single frame needs more.
+	static constexpr std::size_t SEGMENT_SLOTS = 1024;
+
+	ShadowStack() noexcept : _first(nullptr), _current(nullptr) {}
+
+	ShadowStack(const ShadowStack&) = delete;
+
+	~ShadowStack() noexcept
+	{
+		ShadowStackSegment* segment = _first;
+		while (nullptr != segment) {
+			ShadowStackSegment* next = segment->next;
+			delete segment;
+			segment = next;
+		}
+	}
+
+	/// Reserve a frame of `count` contiguous slots, initialized to null.
+	void** reserve(std::size_t count)
+	{
+		void** frame = nullptr;
+		if ((nullptr != _current) && (count <= std::size_t(_current->limit - _current->top))) {
+			frame = _current->top;
+			_current->top += count;
+		} else {
+			frame = reserveInNextSegment(count);
+		}
+		for (std::size_t i = 0; i < count; i++) {
+			frame[i] = nullptr;
+		}
+		return frame;
+	}
+
+	/// Release the frame starting at `frame`, and every frame reserved after it.
+	void release(void** frame) noexcept
+	{
+		if (!_current->contains(frame)) {
+			unwindToSegment(frame);
+		}
+		_current->top = frame;
+	}
+
+	/// The first segment, or null if nothing was ever reserved. Segments following the current one are empty.
+	ShadowStackSegment* firstSegment() const noexcept { return _first; }
+
+	/// Call fn(void**) for every live slot, in the order the slots were reserved.
+	template<typename FnT>
+	void forEachSlot(FnT&& fn) const
+	{
+		for (ShadowStackSegment* segment = _first; nullptr != segment; segment = segment->next) {
+			for (void** slot = segment->base; slot < segment->top; slot++) {
+				fn(slot);
+			}
+		}
+	}
+
+private:
+	/// Slow path of reserve: the frame does not fit in the current segment.
+	void** reserveInNextSegment(std::size_t count)
+	{
+		ShadowStackSegment* next = (nullptr == _current) ? _first : _current->next;
+
+		if ((nullptr != next) && (next->capacity() < count)) {
+			/* too small for this frame; the segment and all that follow it are empty */
+			if (nullptr == _current) {
+				_first = nullptr;
+			} else {
+				_current->next = nullptr;
+			}
+			while (nullptr != next) {
+				ShadowStackSegment* following = next->next;
+				delete next;
+				next = following;
+			}
+		}
+
+		if (nullptr == next) {
+			next = new ShadowStackSegment((count > SEGMENT_SLOTS) ? count : SEGMENT_SLOTS);
+			next->prev = _current;
+			if (nullptr == _current) {
+				_first = next;
+			} else {
+				_current->next = next;
+			}
+		}
+
+		_current = next;
+		void** frame = _current->top;
+		_current->top += count;
+		return frame;
+	}
+
+	/// Slow path of release: the frame lives in an earlier segment.
+	void unwindToSegment(void** frame) noexcept
+	{
+		while (!_current->contains(frame)) {
+			_current->top = _current->base;
+			_current = _current->prev;
+			assert(nullptr != _current);
+		}
+	}
+
+	ShadowStackSegment* _first;
+	ShadowStackSegment* _current;
+};
+
+} // namespace GC
+} // namespace OMR
+
+#endif // OMR_GC_SHADOWSTACK_HPP_
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *  Copyright (c) 2018, 2018 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_STATICROOTSET_HPP_)
+#define OMR_GC_STATICROOTSET_HPP_
+
+#include <OMR/GC/RootSet.hpp>
+
+#include <omrcfg.h>
+#include <CompactScheme.hpp>
+#include <MarkingScheme.hpp>
+#include <Scavenger.hpp>
+
+#include <memory>
+
+namespace OMR
+{
+namespace GC
+{
+
+/// Adapts any object with a member template `template<typename VisitorT> void visit(VisitorT&)` to a RootSet.
+///
+/// Each collector makes one virtual call per registered set, into an instantiation of `T::visit` for that
+/// collector's concrete visitor type. Within `visit`, calls to `visitor.edge(...)` are statically bound, unlike the
+/// per-root std::function calls of the MarkingFn family, and all but the scavenger's can be inlined. Report root
+/// slots with a RefSlotHandle, and skip null slots, which the scavenger does not expect.
+///
+/// The root set does not own `roots`, which must outlive its registration.
+template<typename T>
+class StaticRootSet final : public RootSet
+{
+public:
+	explicit StaticRootSet(T& roots) noexcept : _roots(roots) {}
+
+	virtual void scan(MarkingVisitor& visitor) override { _roots.visit(visitor); }
+
+	virtual void scan(ScavengingRootVisitor& visitor) override
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		_roots.visit(visitor);
+#endif // OMR_GC_MODRON_SCAVENGER
+	}
+
+	virtual void scan(CompactingVisitor& visitor) override
+	{
+#if defined(OMR_GC_MODRON_COMPACTION)
+		_roots.visit(visitor);
+#endif // OMR_GC_MODRON_COMPACTION
+	}
+
+private:
+	T& _roots;
+};
+
+/// Wrap `roots` for registration in a System's or Context's rootSets().
+template<typename T>
+std::unique_ptr<RootSet>
+makeRootSet(T& roots)
+{
+	return std::unique_ptr<RootSet>(new StaticRootSet<T>(roots));
+}
+
+} // namespace GC
+} // namespace OMR
+
+#endif // OMR_GC_STATICROOTSET_HPP_
@@ -25,7 +25,9 @@
 
 #include <OMR/GC/CompactingFn.hpp>
 #include <OMR/GC/MarkingFn.hpp>
+#include <OMR/GC/RootSet.hpp>
 #include <OMR/GC/ScavengingFn.hpp>
+#include <OMR/GC/ShadowStack.hpp>
 #include <OMR/GC/StackRootList.hpp>
 #include <OMR/GC/LocalHeapCache.hpp>
 #include <EnvironmentBase.hpp>
@@ -92,6 +94,14 @@ public:
 
 	const CompactingFnVector &compactingFns() const noexcept { return _compactingFns; }
 
+	RootSetVector &rootSets() noexcept { return _rootSets; }
+
+	const RootSetVector &rootSets() const noexcept { return _rootSets; }
+
+	RootRangeVector &rootRanges() noexcept { return _rootRanges; }
+
+	const RootRangeVector &rootRanges() const noexcept { return _rootRanges; }
+
 	ContextList &contexts() { return _contexts; }
 
 	const ContextList &contexts() const { return _contexts; }
@@ -115,6 +125,8 @@ private:
 	MarkingFnVector _userRoots;
 	ScavengingFnVector _scavengingFns;
 	CompactingFnVector _compactingFns;
+	RootSetVector _rootSets;
+	RootRangeVector _rootRanges;
 };
 
 /// A GC context. Base class. GC users should create Contexts.
@@ -164,6 +176,10 @@ public:
 
 	StackRootList &stackRoots() noexcept { return _stackRoots; }
 
+	ShadowStack &shadowStack() noexcept { return _shadowStack; }
+
+	const ShadowStack &shadowStack() const noexcept { return _shadowStack; }
+
 	MarkingFnVector &markingFns() noexcept { return _userMarkingFns; }
 
 	const MarkingFnVector &markingFns() const noexcept { return _userMarkingFns; }
@@ -176,6 +192,14 @@ public:
 
 	const ScavengingFnVector &scavengingFns() const noexcept { return _scavengingFns; }
 
+	RootSetVector &rootSets() noexcept { return _rootSets; }
+
+	const RootSetVector &rootSets() const noexcept { return _rootSets; }
+
+	RootRangeVector &rootRanges() noexcept { return _rootRanges; }
+
+	const RootRangeVector &rootRanges() const noexcept { return _rootRanges; }
+
 	LocalHeapCache& heapCache() noexcept { return _heapCache; }
 
 	const LocalHeapCache& heapCache() const noexcept { return _heapCache; }
@@ -193,9 +217,12 @@ private:
 	NonZeroLocalHeapCache _nonZeroHeapCache;
 	ContextListNode _node;
 	StackRootList _stackRoots;
+	ShadowStack _shadowStack;
 	MarkingFnVector _userMarkingFns;
 	ScavengingFnVector _scavengingFns;
 	CompactingFnVector _compactingFns;
+	RootSetVector _rootSets;
+	RootRangeVector _rootRanges;
 };
 
 // static_assert(std::is_standard_layout<Context>::value,
@@ -231,6 +258,19 @@ getContext(MM_EnvironmentBase *env)
 	return getContext(env->getOmrVMThread());
 }
 
+/// Unlike getContext, valid on any thread attached to the VM, including GC slave threads.
+inline System &
+getSystem(OMR_VM *vm)
+{
+	return *static_cast<System *>(vm->_language_vm);
+}
+
+inline System &
+getSystem(MM_EnvironmentBase *env)
+{
+	return getSystem(env->getOmrVM());
+}
+
 /// @}
 
 } // namespace GC
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *  Copyright (c) 2026, 2026 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "TestHeap.hpp"
+
+#include <gtest/gtest.h>
+
+namespace OMR {
+namespace GC {
+namespace Test {
+
+/// Slots are fomrobject_t wide: 4 bytes with compressed references, so that an object's header and
+/// slots do not always fill a whole number of alignment units.
+TEST(HeapSlotTest, allocSizeIsAligned) {
+	for (std::size_t nslots = 0; nslots < 8; nslots++) {
+		EXPECT_EQ(Object::allocSize(nslots) % BASE_OBJECT_ALIGNMENT_FACTOR, 0u);
+		EXPECT_GE(Object::allocSize(nslots), sizeof(ObjectHeader) + (nslots * sizeof(fomrobject_t)));
+	}
+}
+
+/// References stored through heap slot handles survive a scavenge and a global collection with compaction,
+/// for objects with both even and odd slot counts.
+TEST(HeapSlotTest, heapSlotReferentsSurvive) {
+	RunContext& cx = testContext();
+	static const std::size_t COUNTS[] = {1, 2, 3, 4, 6};
+	static const std::size_t HOLDERS = sizeof(COUNTS) / sizeof(COUNTS[0]);
+	void* holders[HOLDERS];
+
+	for (std::size_t i = 0; i < HOLDERS; i++) {
+		holders[i] = nullptr;
+	}
+	cx.rootRanges().push_back(RootRange{holders, HOLDERS});
+
+	for (std::size_t i = 0; i < HOLDERS; i++) {
+		holders[i] = allocateObject(cx, COUNTS[i]);
+		for (std::size_t slot = 0; slot < COUNTS[i]; slot++) {
+			Object* leaf = allocateLeaf(cx, std::uint32_t(0xE000 + (i << 4) + slot));
+			storeSlot(cx, static_cast<Object*>(holders[i]), slot, leaf);
+		}
+	}
+
+	auto check = [&]() {
+		for (std::size_t i = 0; i < HOLDERS; i++) {
+			Object* holder = static_cast<Object*>(holders[i]);
+			ASSERT_NE(holder, nullptr);
+			for (std::size_t slot = 0; slot < COUNTS[i]; slot++) {
+				Object* leaf = loadSlot(cx, holder, slot);
+				ASSERT_NE(leaf, nullptr);
+				EXPECT_EQ(leafValue(leaf), std::uint32_t(0xE000 + (i << 4) + slot));
+			}
+			/* slots padding the object out to the alignment stay null */
+			for (std::size_t slot = COUNTS[i]; slot < holder->slotCount(); slot++) {
+				EXPECT_EQ(loadSlot(cx, holder, slot), nullptr);
+			}
+		}
+	};
+
+	if (scavengerEnabled(cx)) {
+		EXPECT_TRUE(scavengeUntilMoved(cx, &holders[1]));
+		check();
+	}
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+	check();
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+	check();
+
+	cx.rootRanges().clear();
+}
+
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+/// A compressed slot holds the referent shifted right by the heap's compressed pointers shift.
+TEST(HeapSlotTest, compressedSlotHoldsShiftedReference) {
+	RunContext& cx = testContext();
+	void* root = allocateObject(cx, 2);
+	cx.rootRanges().push_back(RootRange{&root, 1});
+
+	Object* leaf = allocateLeaf(cx, 0xF00D);
+	Object* holder = static_cast<Object*>(root);
+	storeSlot(cx, holder, 0, leaf);
+
+	EXPECT_EQ(sizeof(fomrobject_t), 4u);
+	EXPECT_EQ(std::uintptr_t(holder->slots()[0]), std::uintptr_t(leaf) >> cx.system().vm()._compressedPointersShift);
+	EXPECT_EQ(loadSlot(cx, holder, 0), leaf);
+
+	cx.rootRanges().clear();
+}
+#endif /* OMR_GC_COMPRESSED_POINTERS */
+
+} // namespace Test
+} // namespace GC
+} // namespace OMR
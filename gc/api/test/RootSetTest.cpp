@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *  Copyright (c) 2026, 2026 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <OMR/GC/RefSlotHandle.hpp>
+#include <OMR/GC/RootSet.hpp>
+#include <OMR/GC/StaticRootSet.hpp>
+
+#include "TestHeap.hpp"
+
+#include <gtest/gtest.h>
+
+namespace OMR {
+namespace GC {
+namespace Test {
+
+/// Roots in a plain struct, reported through a StaticRootSet.
+struct TestRoots
+{
+	template<typename VisitorT>
+	void visit(VisitorT& visitor)
+	{
+		for (Object*& ref : refs) {
+			if (nullptr != ref) {
+				visitor.edge(nullptr, RefSlotHandle(&ref));
+			}
+		}
+	}
+
+	Object* refs[4];
+};
+
+/// Populate `slots` with leaves holding `base + index`, leaving the last slot null.
+static void
+fillLeaves(RunContext& cx, void** slots, std::size_t count, std::uint32_t base)
+{
+	for (std::size_t i = 0; i < count - 1; i++) {
+		slots[i] = allocateLeaf(cx, base + std::uint32_t(i));
+	}
+	slots[count - 1] = nullptr;
+}
+
+static void
+checkLeaves(void** slots, std::size_t count, std::uint32_t base)
+{
+	for (std::size_t i = 0; i < count - 1; i++) {
+		ASSERT_NE(slots[i], nullptr);
+		EXPECT_EQ(leafValue(static_cast<Object*>(slots[i])), base + std::uint32_t(i));
+	}
+	EXPECT_EQ(slots[count - 1], nullptr);
+}
+
+/// Scavenge if the heap has a nursery, then collect globally, with and without compaction,
+/// calling check() after each collection.
+template<typename CheckT>
+static void
+collectAll(RunContext& cx, void** moving, CheckT&& check)
+{
+	if (scavengerEnabled(cx)) {
+		EXPECT_TRUE(scavengeUntilMoved(cx, moving));
+		check();
+	}
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+	check();
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+	check();
+}
+
+TEST(RootSetTest, rootRangeReferentsSurvive) {
+	RunContext& cx = testContext();
+	void* systemTable[5];
+	void* contextTable[3];
+	fillLeaves(cx, systemTable, 5, 0xA000);
+	fillLeaves(cx, contextTable, 3, 0xB000);
+
+	cx.system().rootRanges().push_back(RootRange{systemTable, 5});
+	cx.rootRanges().push_back(RootRange{contextTable, 3});
+
+	collectAll(cx, &contextTable[0], [&]() {
+		checkLeaves(systemTable, 5, 0xA000);
+		checkLeaves(contextTable, 3, 0xB000);
+	});
+
+	cx.rootRanges().clear();
+	cx.system().rootRanges().clear();
+}
+
+TEST(RootSetTest, rootSetReferentsSurvive) {
+	RunContext& cx = testContext();
+	TestRoots systemRoots;
+	TestRoots contextRoots;
+	fillLeaves(cx, reinterpret_cast<void**>(systemRoots.refs), 4, 0xC000);
+	fillLeaves(cx, reinterpret_cast<void**>(contextRoots.refs), 4, 0xD000);
+
+	cx.system().rootSets().push_back(makeRootSet(systemRoots));
+	cx.rootSets().push_back(makeRootSet(contextRoots));
+
+	/* a leaf reachable only through a root set's referent */
+	Object* holder = allocateObject(cx, 3);
+	storeSlot(cx, holder, 0, contextRoots.refs[0]);
+	contextRoots.refs[1] = holder;
+
+	collectAll(cx, reinterpret_cast<void**>(&systemRoots.refs[0]), [&]() {
+		checkLeaves(reinterpret_cast<void**>(systemRoots.refs), 4, 0xC000);
+		EXPECT_EQ(leafValue(contextRoots.refs[0]), 0xD000u);
+		EXPECT_EQ(leafValue(contextRoots.refs[2]), 0xD002u);
+		EXPECT_EQ(loadSlot(cx, contextRoots.refs[1], 0), contextRoots.refs[0]);
+		EXPECT_EQ(contextRoots.refs[3], nullptr);
+	});
+
+	cx.rootSets().clear();
+	cx.system().rootSets().clear();
+}
+
+} // namespace Test
+} // namespace GC
+} // namespace OMR
@@ -0,0 +1,224 @@
+/*******************************************************************************
+ *  Copyright (c) 2026, 2026 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <OMR/GC/ShadowFrame.hpp>
+#include <OMR/GC/ShadowStack.hpp>
+
+#include "TestHeap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace OMR {
+namespace GC {
+namespace Test {
+
+/* a copy, so that gtest may take its address */
+static const std::size_t SEGMENT_SLOTS = ShadowStack::SEGMENT_SLOTS;
+
+static std::size_t
+liveSlots(const ShadowStack& stack)
+{
+	std::size_t count = 0;
+	stack.forEachSlot([&](void**) { count++; });
+	return count;
+}
+
+TEST(ShadowStackTest, emptyStack) {
+	ShadowStack stack;
+	EXPECT_EQ(stack.firstSegment(), nullptr);
+	EXPECT_EQ(liveSlots(stack), 0u);
+}
+
+TEST(ShadowStackTest, framesAreNullAndContiguous) {
+	ShadowStack stack;
+	void** a = stack.reserve(3);
+	void** b = stack.reserve(5);
+	EXPECT_EQ(b, a + 3);
+	for (std::size_t i = 0; i < 8; i++) {
+		EXPECT_EQ(a[i], nullptr);
+	}
+	EXPECT_EQ(liveSlots(stack), 8u);
+	stack.release(b);
+	EXPECT_EQ(liveSlots(stack), 3u);
+	stack.release(a);
+	EXPECT_EQ(liveSlots(stack), 0u);
+}
+
+TEST(ShadowStackTest, frameDoesNotSpanSegments) {
+	ShadowStack stack;
+	void** a = stack.reserve(SEGMENT_SLOTS - 2);
+	ShadowStackSegment* first = stack.firstSegment();
+	void** b = stack.reserve(4);
+
+	ShadowStackSegment* second = first->next;
+	ASSERT_NE(second, nullptr);
+	EXPECT_EQ(second->prev, first);
+	EXPECT_EQ(b, second->base);
+	EXPECT_EQ(first->top, a + SEGMENT_SLOTS - 2);
+	EXPECT_EQ(liveSlots(stack), SEGMENT_SLOTS + 2);
+
+	stack.release(b);
+	EXPECT_EQ(second->top, second->base);
+	stack.release(a);
+	EXPECT_EQ(first->top, first->base);
+}
+
+TEST(ShadowStackTest, releaseUnwindsSegments) {
+	ShadowStack stack;
+	void** a = stack.reserve(SEGMENT_SLOTS);
+	stack.reserve(SEGMENT_SLOTS);
+	stack.reserve(SEGMENT_SLOTS);
+	EXPECT_EQ(liveSlots(stack), 3 * SEGMENT_SLOTS);
+
+	ShadowStackSegment* first = stack.firstSegment();
+	ShadowStackSegment* second = first->next;
+	ShadowStackSegment* third = second->next;
+	ASSERT_NE(third, nullptr);
+
+	/* releasing the first frame unwinds through the two later segments */
+	stack.release(a);
+	EXPECT_EQ(liveSlots(stack), 0u);
+	EXPECT_EQ(second->top, second->base);
+	EXPECT_EQ(third->top, third->base);
+
+	/* the segments are retained and reused, in order */
+	void** b = stack.reserve(SEGMENT_SLOTS);
+	void** c = stack.reserve(1);
+	void** d = stack.reserve(SEGMENT_SLOTS);
+	EXPECT_EQ(b, first->base);
+	EXPECT_EQ(c, second->base);
+	EXPECT_EQ(d, third->base);
+	EXPECT_EQ(stack.firstSegment(), first);
+	EXPECT_EQ(first->next, second);
+	EXPECT_EQ(second->next, third);
+
+	/* releasing a frame at the base of a segment leaves the earlier segment intact */
+	stack.release(d);
+	EXPECT_EQ(liveSlots(stack), SEGMENT_SLOTS + 1);
+	stack.release(c);
+	EXPECT_EQ(liveSlots(stack), SEGMENT_SLOTS);
+	stack.release(b);
+	EXPECT_EQ(liveSlots(stack), 0u);
+}
+
+TEST(ShadowStackTest, oversizedFrame) {
+	ShadowStack stack;
+	void** a = stack.reserve(SEGMENT_SLOTS - 1);
+	void** b = stack.reserve(1);
+	stack.reserve(2);
+	stack.release(b);
+
+	/* the retained second segment is too small for this frame, and is replaced */
+	void** c = stack.reserve(SEGMENT_SLOTS * 2);
+	ShadowStackSegment* second = stack.firstSegment()->next;
+	ASSERT_NE(second, nullptr);
+	EXPECT_EQ(second->base, c);
+	EXPECT_EQ(second->capacity(), SEGMENT_SLOTS * 2);
+	EXPECT_EQ(second->next, nullptr);
+	EXPECT_EQ(liveSlots(stack), SEGMENT_SLOTS * 3 - 1);
+
+	/* a frame that fits reuses the oversized segment */
+	stack.release(b);
+	EXPECT_EQ(stack.reserve(SEGMENT_SLOTS), second->base);
+
+	stack.release(a);
+	EXPECT_EQ(liveSlots(stack), 0u);
+}
+
+TEST(ShadowStackTest, forEachSlotOrder) {
+	ShadowStack stack;
+	std::vector<void**> reserved;
+	std::vector<void**> frames;
+	for (std::size_t size : {7u, 1000u, 100u, 1024u, 3u}) {
+		void** frame = stack.reserve(size);
+		frames.push_back(frame);
+		for (std::size_t i = 0; i < size; i++) {
+			reserved.push_back(&frame[i]);
+		}
+	}
+	ASSERT_NE(stack.firstSegment()->next->next->next, nullptr);
+
+	std::vector<void**> visited;
+	stack.forEachSlot([&](void** slot) { visited.push_back(slot); });
+	EXPECT_EQ(visited, reserved);
+
+	/* after a release, only the slots of the remaining frames are visited, still in order */
+	stack.release(frames[2]);
+	reserved.resize(1007);
+	visited.clear();
+	stack.forEachSlot([&](void** slot) { visited.push_back(slot); });
+	EXPECT_EQ(visited, reserved);
+}
+
+TEST(ShadowStackTest, shadowFrameReleasesOnDestruction) {
+	ShadowStack stack;
+	{
+		ShadowFrame outer(stack, 2);
+		{
+			ShadowFrame inner(stack, SEGMENT_SLOTS);
+			EXPECT_EQ(liveSlots(stack), SEGMENT_SLOTS + 2);
+		}
+		EXPECT_EQ(liveSlots(stack), 2u);
+	}
+	EXPECT_EQ(liveSlots(stack), 0u);
+}
+
+TEST(ShadowStackTest, collectionKeepsReferentsAlive) {
+	RunContext& cx = testContext();
+
+	/* a frame after a nearly full one lands in the next segment */
+	ShadowFrame padding(cx, SEGMENT_SLOTS - 1);
+	ShadowFrame frame(cx, 4);
+	EXPECT_NE(cx.shadowStack().firstSegment()->next, nullptr);
+
+	for (std::uint32_t i = 0; i < 3; i++) {
+		frame.set(i, allocateLeaf(cx, 0xC0FFEE00 + i));
+	}
+	frame.set(3, allocateObject(cx, 3));
+	storeSlot(cx, frame.get<Object>(3), 0, frame.get<Object>(0));
+	padding.set(0, frame.get<Object>(3));
+
+	auto check = [&]() {
+		for (std::uint32_t i = 0; i < 3; i++) {
+			EXPECT_EQ(leafValue(frame.get<Object>(i)), 0xC0FFEE00 + i);
+		}
+		EXPECT_EQ(padding.get<Object>(0), frame.get<Object>(3));
+		EXPECT_EQ(loadSlot(cx, frame.get<Object>(3), 0), frame.get<Object>(0));
+	};
+
+	if (scavengerEnabled(cx)) {
+		EXPECT_TRUE(scavengeUntilMoved(cx, &frame[0]));
+		check();
+	}
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+	check();
+
+	OMR_GC_SystemCollect(cx.vmContext(), J9MMCONSTANT_EXPLICIT_GC_RASDUMP_COMPACT);
+	check();
+}
+
+} // namespace Test
+} // namespace GC
+} // namespace OMR
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ *  Copyright (c) 2026, 2026 IBM and others
+ *
+ *  This program and the accompanying materials are made available under
+ *  the terms of the Eclipse Public License 2.0 which accompanies this
+ *  distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ *  or the Apache License, Version 2.0 which accompanies this distribution and
+ *  is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ *  This Source Code may also be made available under the following
+ *  Secondary Licenses when the conditions for such availability set
+ *  forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ *  General Public License, version 2 with the GNU Classpath
+ *  Exception [1] and GNU General Public License, version 2 with the
+ *  OpenJDK Assembly Exception [2].
+ *
+ *  [1] https://www.gnu.org/software/classpath/license.html
+ *  [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ *  SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(OMR_GC_TEST_TESTHEAP_HPP_)
+#define OMR_GC_TEST_TESTHEAP_HPP_
+
+#include <OMR/GC/AccessBarrier.hpp>
+#include <OMR/GC/Allocator.hpp>
+#include <OMR/GC/HeapSlotHandle.hpp>
+#include <OMR/GC/System.hpp>
+#include <OMR/Runtime.hpp>
+
+#include "GCExtensionsBase.hpp"
+#include "Object.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace OMR {
+namespace GC {
+namespace Test {
+
+/// The heap shared by every test in a process. A System does not shut down its heap when destroyed, so each test
+/// binary starts exactly one, with a generational policy unless OMR_GC_OPTIONS says otherwise.
+struct TestHeap
+{
+	TestHeap() : runtime(), system(init(runtime)), cx(system) {}
+
+	static TestHeap& get()
+	{
+		static TestHeap heap;
+		return heap;
+	}
+
+	static Runtime& init(Runtime& runtime)
+	{
+		setenv("OMR_GC_OPTIONS", "-Xgcpolicy:gencon", 0);
+		return runtime;
+	}
+
+	Runtime runtime;
+	System system;
+	RunContext cx;
+};
+
+inline RunContext&
+testContext()
+{
+	return TestHeap::get().cx;
+}
+
+/// True if the heap has a nursery, so that scavenges move objects.
+inline bool
+scavengerEnabled(Context& cx)
+{
+	return cx.env()->getExtensions()->scavengerEnabled;
+}
+
+/// Allocate an object with `nslots` null reference slots.
+inline Object*
+allocateObject(Context& cx, std::size_t nslots)
+{
+	const std::size_t size = Object::allocSize(nslots);
+	return allocate<Object>(cx, size, [=](Object* obj) -> void { new (obj) Object(size); });
+}
+
+/// Allocate a leaf object whose payload holds `value`, which the GC does not scan.
+inline Object*
+allocateLeaf(Context& cx, std::uint32_t value)
+{
+	const std::size_t size = Object::allocSize(3);
+	return allocate<Object>(cx, size, [=](Object* obj) -> void {
+		new (obj) Object(size, OBJECT_FLAG_LEAF);
+		*reinterpret_cast<std::uint32_t*>(obj->slots()) = value;
+	});
+}
+
+inline std::uint32_t
+leafValue(const Object* leaf)
+{
+	return *reinterpret_cast<const std::uint32_t*>(leaf->slots());
+}
+
+inline void
+storeSlot(RunContext& cx, Object* object, std::size_t index, Object* value)
+{
+	store(cx, object, makeHeapSlotHandle(&object->slots()[index], cx.system().vm()._compressedPointersShift), value);
+}
+
+inline Object*
+loadSlot(RunContext& cx, Object* object, std::size_t index)
+{
+	return makeHeapSlotHandle(&object->slots()[index], cx.system().vm()._compressedPointersShift).readReference();
+}
+
+/// Allocate garbage until `*root` is moved by a scavenge, or give up after allocating `limit` bytes.
+/// @returns true if the referent moved.
+inline bool
+scavengeUntilMoved(Context& cx, void** root, std::size_t limit = 256 * 1024 * 1024)
+{
+	void* const original = *root;
+	const std::size_t size = Object::allocSize(31);
+	for (std::size_t allocated = 0; allocated < limit; allocated += size) {
+		allocateObject(cx, 31);
+		if (*root != original) {
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace Test
+} // namespace GC
+} // namespace OMR
+
+#endif // OMR_GC_TEST_TESTHEAP_HPP_
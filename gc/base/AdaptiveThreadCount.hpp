@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ADAPTIVETHREADCOUNT_HPP_)
+#define ADAPTIVETHREADCOUNT_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseNonVirtual.hpp"
+
+/**
+ * Chooses how many GC threads a parallel phase is dispatched with, from the work the same phase did last cycle.
+ *
+ * A phase that copied or scanned only a little gains nothing from waking every GC thread: most of them find no
+ * work, and the rest pay for the synchronization.  After each cycle the collector reports the bytes of work the
+ * phase did, and the next dispatch uses one thread for every adaptiveGCThreadingWorkPerThread bytes of it.  The
+ * count follows a growing load at once, so a cycle that piles up work is not starved, and follows a shrinking
+ * load only halfway per cycle, so one small cycle does not starve the next large one.
+ *
+ * The count is fixed for the duration of a task, since the GC threads of a task synchronize on it.
+ */
+class MM_AdaptiveThreadCount : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _threadCount; /**< threads for the next dispatch, UDATA_MAX until a cycle has been measured */
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * @param threadCountMaximum the thread count the dispatcher would use by default
+	 * @return the thread count to dispatch the phase with, never more than threadCountMaximum
+	 */
+	MMINLINE uintptr_t
+	getThreadCount(uintptr_t threadCountMaximum)
+	{
+		return OMR_MIN(_threadCount, threadCountMaximum);
+	}
+
+	/**
+	 * Record the work done by the phase in the cycle that just ended.
+	 * @param work bytes copied or scanned by the phase
+	 * @param workPerThread bytes of work that justify one thread
+	 * @param threadCountMaximum the thread count the dispatcher would use by default
+	 */
+	MMINLINE void
+	update(uintptr_t work, uintptr_t workPerThread, uintptr_t threadCountMaximum)
+	{
+		uintptr_t threadCount = threadCountMaximum;
+		if (0 != workPerThread) {
+			threadCount = OMR_MIN((work / workPerThread) + 1, threadCountMaximum);
+		}
+
+		if ((UDATA_MAX == _threadCount) || (threadCount >= _threadCount)) {
+			_threadCount = threadCount;
+		} else {
+			_threadCount = threadCount + ((_threadCount - threadCount) / 2);
+		}
+	}
+
+	/**
+	 * Forget the measured work, so the next dispatch uses every thread.
+	 */
+	MMINLINE void reset() { _threadCount = UDATA_MAX; }
+
+	MM_AdaptiveThreadCount()
+		: MM_BaseNonVirtual()
+		, _threadCount(UDATA_MAX)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ADAPTIVETHREADCOUNT_HPP_ */
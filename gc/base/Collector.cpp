@@ -25,6 +25,7 @@
 #include "GCExtensionsBase.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "Heap.hpp"
+#include "IdleHeapManager.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
 #include "ObjectAllocationInterface.hpp"
@@ -197,6 +198,13 @@ MM_Collector::preCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace, M
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/* Collections write to free memory, so pages released while idle can no longer be trusted to read as zero */
+	if (NULL != extensions->idleHeapManager) {
+		extensions->idleHeapManager->forgetKnownZeroMemory(env);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	/* There might be a colliding concurrent cycle in progress, that must be completed before we start this one.
 	 * Specific Collector subclass will have exact knowledge if that is the case.
 	 */
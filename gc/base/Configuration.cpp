@@ -36,7 +36,9 @@
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapCensusManager.hpp"
 #include "HeapRegionManager.hpp"
+#include "IdleHeapManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
 #include "MemoryManager.hpp"
@@ -74,6 +76,16 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 				initializeGCParameters(env);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				if (result && extensions->gcOnIdle) {
+					extensions->idleHeapManager = MM_IdleHeapManager::newInstance(env);
+					result = (NULL != extensions->idleHeapManager);
+				}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+				if (result && extensions->heapCensusEnabled) {
+					extensions->heapCensusManager = MM_HeapCensusManager::newInstance(env);
+					result = (NULL != extensions->heapCensusManager);
+				}
 			}
 		}
 	}
@@ -136,6 +148,18 @@ MM_Configuration::tearDown(MM_EnvironmentBase* env)
 		extensions->heapRegionManager = NULL;
 	}
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != extensions->idleHeapManager) {
+		extensions->idleHeapManager->kill(env);
+		extensions->idleHeapManager = NULL;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
+	if (NULL != extensions->heapCensusManager) {
+		extensions->heapCensusManager->kill(env);
+		extensions->heapCensusManager = NULL;
+	}
+
 	if (NULL != extensions->_lightweightNonReentrantLockPool) {
 		pool_kill(extensions->_lightweightNonReentrantLockPool);
 		extensions->_lightweightNonReentrantLockPool = NULL;
@@ -389,13 +413,23 @@ MM_Configuration::initializeRegionSize(MM_EnvironmentBase* env)
 		regionSize = _defaultRegionSize;
 	}
 
+	uintptr_t hugePageSize = extensions->heapHugePageSize;
+	if (0 != hugePageSize) {
+		/* Regions are the unit of heap layout, so huge page sized regions put every subspace boundary on a huge page */
+		regionSize = OMR_MAX(regionSize, hugePageSize);
+	}
+
 	uintptr_t shift = calculatePowerOfTwoShift(env, regionSize);
-	if (0 == shift) {
+	if ((0 == shift) || ((0 != hugePageSize) && (0 != (hugePageSize & (hugePageSize - 1))))) {
 		result = false;
 	} else {
 		/* set the log and the power of two size */
 		uintptr_t powerOfTwoRegionSize = ((uintptr_t)1 << shift);
 		extensions->regionSize = powerOfTwoRegionSize;
+		if (0 != hugePageSize) {
+			/* Commits, decommits and resizes are rounded to the heap alignment */
+			extensions->heapAlignment = OMR_MAX(extensions->heapAlignment, powerOfTwoRegionSize);
+		}
 		result = verifyRegionSize(env, powerOfTwoRegionSize);
 	}
 
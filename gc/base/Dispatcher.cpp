@@ -26,6 +26,7 @@
 #include "Dispatcher.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "Task.hpp"
 
 MM_Dispatcher *
@@ -95,6 +96,10 @@ MM_Dispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCo
 		setThreadCount(newThreadCount);
 	}
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	task->_phaseStats.clear();
+	task->_dispatchStartTime = omrtime_hires_clock();
+
 	task->masterSetup(env);
 	prepareThreadsForTask(env, task);
 	acceptTask(env);
@@ -103,6 +108,16 @@ MM_Dispatcher::run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t newThreadCo
 	cleanupAfterTask(env);
 	task->masterCleanup(env);
 
+	/* all threads have merged their timings into the task by now */
+	TRIGGER_J9HOOK_MM_PRIVATE_TASK_PHASE_END(
+		env->getExtensions()->privateHookInterface,
+		env->getOmrVMThread(),
+		omrtime_hires_clock(),
+		J9HOOK_MM_PRIVATE_TASK_PHASE_END,
+		task->getBaseVirtualTypeId(),
+		task->getVMStateID(),
+		task->getPhaseStats());
+
 	/* restore the default thread count */
 	setThreadCount(defaultThreadCount);
 }
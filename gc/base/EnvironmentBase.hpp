@@ -35,11 +35,13 @@
 #include "EnvironmentDelegate.hpp"
 #include "GCCode.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapCensus.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MarkStats.hpp"
 #include "RootScannerStats.hpp"
 #include "ScavengerStats.hpp"
 #include "SweepStats.hpp"
+#include "TaskPhaseStats.hpp"
 #include "WorkPacketStats.hpp"
 #include "WorkStack.hpp"
 
@@ -135,6 +137,7 @@ public:
 	bool _failAllocOnExcessiveGC;
 
 	MM_Task *_currentTask;
+	MM_TaskPhaseStats _taskPhaseStats; /**< Per thread timing of the current task, merged into the task on completion */
 	
 	MM_WorkPacketStats _workPacketStats;
 	MM_WorkPacketStats _workPacketStatsRSScan;   /**< work packet Stats specifically for RS Scan Phase of Concurrent STW GC */
@@ -148,10 +151,12 @@ public:
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
 
 	MM_MarkStats _markStats;
+	MM_HeapCensus *_heapCensus; /**< table this GC thread counts visited objects into, NULL unless a heap census is being collected */
 
 	MM_RootScannerStats _rootScannerStats; /**< Per thread stats to track the performance of the root scanner */
 
 	const char * _lastSyncPointReached; /**< string indicating latest sync point reached by this associated env's thread */
+	uintptr_t _syncSpinLimit; /**< how long this thread spins at sync points before it parks, adapted by MM_GCThreadBarrier */
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
@@ -172,6 +177,10 @@ public:
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _concurrentScavengerSwitchCount; /**< local counter of cycle start and cycle end transitions */
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	uintptr_t _concurrentAssistDebt; /**< bytes of concurrent mark work charged to this mutator but not yet paid */
+	uintptr_t _concurrentAssistDebtGCCount; /**< global GC count at which _concurrentAssistDebt was incurred */
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 private:
 
@@ -623,13 +632,19 @@ public:
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_activeValidator(NULL)
+		,_heapCensus(NULL)
 		,_lastSyncPointReached(NULL)
+		,_syncSpinLimit(UDATA_MAX)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		,_concurrentScavengerSwitchCount(0)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_concurrentAssistDebt(0)
+		,_concurrentAssistDebtGCCount(0)
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
 	{
 		_typeId = __FUNCTION__;
@@ -671,13 +686,19 @@ public:
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,_activeValidator(NULL)
+		,_heapCensus(NULL)
 		,_lastSyncPointReached(NULL)
+		,_syncSpinLimit(UDATA_MAX)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		,_concurrentScavengerSwitchCount(0)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		,_concurrentAssistDebt(0)
+		,_concurrentAssistDebtGCCount(0)
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -53,13 +53,20 @@ class MM_CompactGroupPersistentStats;
 class MM_CompressedCardTable;
 class MM_Configuration;
 class MM_Dispatcher;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+class MM_TLHPreZeroingService;
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
 class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
 class MM_GlobalAllocationManager;
 class MM_GlobalCollector;
 class MM_Heap;
+class MM_HeapCensusManager;
 class MM_HeapMap;
 class MM_HeapRegionManager;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+class MM_IdleHeapManager;
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 class MM_InterRegionRememberedSet;
 class MM_MemoryManager;
 class MM_MemorySubSpace;
@@ -93,9 +100,16 @@ struct J9Pool;
 #define DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE 512
 #define DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE 16384
 
+/* The number of popped objects held in flight, while their prefetches complete, before marking scans them (off by default). */
+#define DEFAULT_MARKING_PREFETCH_DISTANCE 0
+#define MAXIMUM_MARKING_PREFETCH_DISTANCE 16
+
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* Copying survivors around the cache is opt-in: whether it pays off depends on the platform and the object mix. */
+#define DEFAULT_SCAVENGER_NON_TEMPORAL_COPY_THRESHOLD 0
+
 #define NO_ESTIMATE_FRAGMENTATION 			0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 		0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 	0x2
@@ -245,6 +259,7 @@ public:
 	bool largePageFailedToSatisfy;
 	uintptr_t requestedPageSize;
 	uintptr_t requestedPageFlags;
+	uintptr_t heapHugePageSize; /**< if non-zero (a power of two, e.g. 2MB or 1GB), regions and all heap commit, decommit and resize boundaries are aligned to it, and the heap is advised for transparent huge pages where supported */
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
 
@@ -298,6 +313,9 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread's TLH refresh size follows its smoothed allocation rate instead of growing by tlhIncrementSize */
+	uintptr_t tlhTargetRefreshInterval; /**< adaptive TLH sizing aims for one refresh per thread every this many microseconds */
+	float tlhAllocationRateHistoryWeight; /**< weight (0.0 to 1.0) of the history in a thread's smoothed allocation rate, the newest sample gets the rest */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -351,9 +369,16 @@ public:
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	bool markingEdgeMode; /**< if true, stop-the-world marking pushes slot addresses instead of objects and tests the mark bit when the slot is popped (ignored with concurrent mark) */
+	uintptr_t markingPrefetchDistance; /**< number of objects popped from the work stack and prefetched ahead of the one being scanned, 0 disables prefetching (at most MAXIMUM_MARKING_PREFETCH_DISTANCE) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 
+	bool heapCensusEnabled; /**< if true, stop-the-world global marks and scavenges count the objects they visit by type and report them through J9HOOK_MM_OMR_HEAP_CENSUS.  Defaults to false. */
+	MM_HeapCensusManager* heapCensusManager; /**< Collects the heap census, created when heapCensusEnabled is set */
+
+	uintptr_t dominatorAnalysisMemoryLimit; /**< native memory the retained size analysis may allocate before it backs its arrays with temporary files.  Defaults to UDATA_MAX (never spill). */
+
 	/* bools and counters for -Xgc:fvtest options */
 	bool fvtest_forceOldResize;
 	uintptr_t fvtest_oldResizeCounter;
@@ -388,15 +413,25 @@ public:
 	uintptr_t fvtest_forceReferenceChainWalkerMarkMapCommitFailureCounter; /**< Force failure at Reference Chain Walker Mark Map commit operation counter */
 
 	uintptr_t fvtest_forceCopyForwardHybridRatio; /**< Force to run CopyForward Hybrid mode value = 1-100 the percentage of non evacuated eden regions */
+	volatile bool fvtest_stallVerboseAsyncWriter; /**< if true the asynchronous verbose writer thread only writes out its queue when the stream is closed, as if it could not keep up */
 	uintptr_t softMx; /**< set through -Xsoftmx, depending on GC policy this number might differ from available heap memory, use MM_Heap::getActualSoftMxSize for calculations */
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	uintptr_t batchClearTLHNonTemporalThreshold; /**< batch cleared TLHs of at least this many bytes are zeroed with stores that bypass the cache, 0 to never use them */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	bool tlhPreZeroing; /**< if true, each thread's next batch cleared TLH is reserved ahead of time and zeroed by a low priority background thread */
+	MM_TLHPreZeroingService *tlhPreZeroingService; /**< the background zeroing thread, NULL unless tlhPreZeroing is set and the thread is running */
+	bool fvtest_verifyPreZeroedTLH; /**< if true, assert that every TLH handed out from a pre-zeroed reserve is zero throughout */
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< if true, scavenges and global marks are dispatched with as many of the GC threads, forced or not, as the work of the previous cycle justifies (see MM_AdaptiveThreadCount) */
+	uintptr_t adaptiveGCThreadingWorkPerThread; /**< bytes copied or scanned in the previous cycle that justify one GC thread when adaptiveGCThreading is set */
+	uintptr_t gcThreadBarrierSpinMaximum; /**< pause instructions a GC thread spins for at most, waiting at a sync point of a parallel task, before it parks */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -428,6 +463,8 @@ public:
 	uintptr_t maxScavengeBeforeGlobal;
 	uintptr_t scvArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in the scavenger */
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
+	uintptr_t scavengerNonTemporalCopyThreshold; /**< objects of at least this many bytes are copied by the scavenger with non-temporal stores, so they do not evict the scan working set (0, the default, disables) */
+	uintptr_t scavengerSurvivorAgeStreams; /**< number of survivor copy cache streams, survivors being grouped by how many scavenges remain before they tenure (1, the default, disables grouping; at most SCAVENGER_SURVIVOR_AGE_STREAMS_MAX) */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
 	bool tiltedScavenge;
@@ -499,6 +536,12 @@ public:
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
+	bool concurrentKickoffForecast; /**< if true, concurrent is also kicked off when the allocation rate forecast predicts free space will run out before marking completes */
+	float concurrentKickoffForecastConfidence; /**< desired probability (0.0 to 1.0) of completing concurrent marking before an allocation failure */
+	uintptr_t concurrentKickoffForecastSampleInterval; /**< minimum time in milliseconds between two allocation rate samples */
+	bool concurrentAssistPacing; /**< if true, mutators accumulate allocation tax as a per-thread debt and pay it in latency-bounded installments */
+	uintptr_t concurrentAssistMinimumPayment; /**< debt in bytes a mutator may carry, while helper threads are marking, before it has to pay */
+	uintptr_t concurrentAssistMaxLatency; /**< soft limit in microseconds on the marking time added to a single allocation */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
@@ -607,6 +650,14 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool verboseBinaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc to file as a binary event stream rather than XML */
+	uintptr_t verboseBinaryBufferSize; /**< size in bytes of each per-thread record buffer of the binary verbose writer (rounded up to a power of two) */
+	uintptr_t verboseBinaryFlushInterval; /**< longest time in milliseconds binary verbose records wait in memory before being written to file */
+	bool verboseAsyncLogging; /**< Enabled by -Xgc:asyncLogging.  Write verbose:gc to file from a dedicated thread so file I/O never delays the GC */
+	uintptr_t verboseAsyncBufferCount; /**< number of buffers the asynchronous verbose writer may fill ahead of its thread before dropping output */
+	uintptr_t verboseAsyncBufferSize; /**< size in bytes of each preallocated buffer of the asynchronous verbose writer; a single output larger than this is dropped */
+	uintptr_t verboseAsyncFlushInterval; /**< longest time in milliseconds the asynchronous verbose writer thread sleeps without checking for work */
+	bool verboseTaskPhaseTimes; /**< Enabled by -Xgc:verboseTaskPhaseTimes.  Report per task work, sync stall and idle times in verbose:gc */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -730,6 +781,9 @@ public:
 	uintptr_t lastGCFreeBytes;  /**< records the free memory size from last Global GC cycle */
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
+	bool idleHeapReleaseLazily; /**< Release idle heap pages with MADV_FREE where available, so that the OS only reclaims them under memory pressure, default is true */
+	uintptr_t idleHeapReleaseSliceMicros; /**< Longest time in microseconds a memory pool stays locked while its free pages are released, default is 1000 */
+	MM_IdleHeapManager* idleHeapManager; /**< Releases idle heap pages and tracks which of them read as zero, created when gcOnIdle is set */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -1231,6 +1285,7 @@ public:
 		, largePageFailedToSatisfy(false)
 		, requestedPageSize(0)
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapHugePageSize(0)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 #if defined(OMR_GC_STACCATO)
@@ -1268,6 +1323,9 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhTargetRefreshInterval(1000)
+		, tlhAllocationRateHistoryWeight(0.5f)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1305,7 +1363,12 @@ public:
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingEdgeMode(false)
+		, markingPrefetchDistance(DEFAULT_MARKING_PREFETCH_DISTANCE)
 		, rootScannerStatsEnabled(false)
+		, heapCensusEnabled(false)
+		, heapCensusManager(NULL)
+		, dominatorAnalysisMemoryLimit(UDATA_MAX)
 		, fvtest_forceOldResize(0)
 		, fvtest_oldResizeCounter(0)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
@@ -1335,9 +1398,21 @@ public:
 		, fvtest_forceReferenceChainWalkerMarkMapCommitFailure(0)
 		, fvtest_forceReferenceChainWalkerMarkMapCommitFailureCounter(0)
 		, fvtest_forceCopyForwardHybridRatio(0)
+		, fvtest_stallVerboseAsyncWriter(false)
 		, softMx(0) /* softMx only set if specified */
 		, batchClearTLH(0)
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		, batchClearTLHNonTemporalThreshold(0)
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		, tlhPreZeroing(false)
+		, tlhPreZeroingService(NULL)
+		, fvtest_verifyPreZeroedTLH(false)
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingWorkPerThread(256 * 1024)
+		, gcThreadBarrierSpinMaximum(4096)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
@@ -1364,6 +1439,8 @@ public:
 		, maxScavengeBeforeGlobal(0)
 		, scvArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, scavengerNonTemporalCopyThreshold(DEFAULT_SCAVENGER_NON_TEMPORAL_COPY_THRESHOLD)
+		, scavengerSurvivorAgeStreams(1)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
 		, tiltedScavenge(true)
@@ -1425,6 +1502,12 @@ public:
 		, concurrentBackground(1)
 #endif /* LINUX && S390 */
 		, concurrentSlack(0)
+		, concurrentKickoffForecast(false)
+		, concurrentKickoffForecastConfidence((float)0.95)
+		, concurrentKickoffForecastSampleInterval(10)
+		, concurrentAssistPacing(false)
+		, concurrentAssistMinimumPayment(64 * 1024)
+		, concurrentAssistMaxLatency(500)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
 		, fvtest_concurrentCardTablePreparationDelay(0)
@@ -1508,6 +1591,14 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, verboseBinaryLogging(false)
+		, verboseBinaryBufferSize(64 * 1024)
+		, verboseBinaryFlushInterval(100)
+		, verboseAsyncLogging(false)
+		, verboseAsyncBufferCount(16)
+		, verboseAsyncBufferSize(16 * 1024)
+		, verboseAsyncFlushInterval(100)
+		, verboseTaskPhaseTimes(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1606,6 +1697,9 @@ public:
 		, lastGCFreeBytes(0)
 		, gcOnIdle(false)
 		, compactOnIdle(false)
+		, idleHeapReleaseLazily(true)
+		, idleHeapReleaseSliceMicros(1000)
+		, idleHeapManager(NULL)
 #endif
 	{
 		_typeId = __FUNCTION__;
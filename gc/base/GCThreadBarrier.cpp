@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "GCThreadBarrier.hpp"
+
+uint32_t
+MM_GCThreadBarrier::addU32(volatile uint32_t *address, uint32_t addend)
+{
+	uint32_t oldValue = 0;
+	do {
+		oldValue = *address;
+	} while (oldValue != MM_AtomicOperations::lockCompareExchangeU32(address, oldValue, oldValue + addend));
+	return oldValue + addend;
+}
+
+void
+MM_GCThreadBarrier::park(volatile uint32_t *address, uint32_t value, volatile uint32_t *waiters)
+{
+	/* a waker changes *address before it reads *waiters, and a parking thread counts itself in before it reads
+	 * *address, so at least one of them sees the other: either the wait is skipped or the wake up is sent
+	 */
+	if (_addressWait) {
+		addU32(waiters, 1);
+		if (value == *address) {
+			omrthread_address_wait(address, value);
+		}
+		addU32(waiters, (uint32_t)-1);
+	} else {
+		omrthread_monitor_enter(_monitor);
+		addU32(waiters, 1);
+		if (value == *address) {
+			omrthread_monitor_wait(_monitor);
+		}
+		addU32(waiters, (uint32_t)-1);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_GCThreadBarrier::wakeAll(volatile uint32_t *address)
+{
+	if (_addressWait) {
+		omrthread_address_wake_all(address);
+	} else {
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+void
+MM_GCThreadBarrier::wait(volatile uint32_t *address, uint32_t value, bool equal, volatile uint32_t *waiters, uintptr_t *spinLimit)
+{
+	uintptr_t spins = OMR_MIN(*spinLimit, _spinMaximum);
+	for (uintptr_t spin = 0; spin <= spins; spin++) {
+		if ((value == *address) != equal) {
+			/* done while spinning: allow a longer spin next time, so a slightly longer wait does not park either */
+			*spinLimit = OMR_MIN(OMR_MAX(spins * 2, GC_THREAD_BARRIER_SPIN_MINIMUM), _spinMaximum);
+			MM_AtomicOperations::loadSync();
+			return;
+		}
+		MM_AtomicOperations::yieldCPU();
+	}
+
+	/* spinning did not pay off this time: spin less next time */
+	*spinLimit = OMR_MAX(spins / 2, OMR_MIN(GC_THREAD_BARRIER_SPIN_MINIMUM, _spinMaximum));
+	for (uint32_t current = *address; (value == current) == equal; current = *address) {
+		park(address, current, waiters);
+	}
+	MM_AtomicOperations::loadSync();
+}
+
+uint32_t
+MM_GCThreadBarrier::arrive()
+{
+	uint32_t arrived = addU32(&_arrived, 1);
+	if (0 != _arrivalWaiters) {
+		wakeAll(&_arrived);
+	}
+	return arrived;
+}
+
+void
+MM_GCThreadBarrier::waitForArrivals(uint32_t threadCount, uintptr_t *spinLimit)
+{
+	wait(&_arrived, threadCount, false, &_arrivalWaiters, spinLimit);
+}
+
+void
+MM_GCThreadBarrier::release()
+{
+	/* the reset must be visible before any released thread can arrive at the next phase */
+	_arrived = 0;
+	MM_AtomicOperations::storeSync();
+	addU32(&_generation, 1);
+	if (0 != _releaseWaiters) {
+		wakeAll(&_generation);
+	}
+}
+
+bool
+MM_GCThreadBarrier::arriveAndWait(uint32_t threadCount, uintptr_t *spinLimit)
+{
+	bool released = false;
+	uint32_t generation = _generation;
+	if (threadCount == arrive()) {
+		release();
+		released = true;
+	} else {
+		waitForRelease(generation, spinLimit);
+	}
+	return released;
+}
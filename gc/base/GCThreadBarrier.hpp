@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(GCTHREADBARRIER_HPP_)
+#define GCTHREADBARRIER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrthread.h"
+#include "thread_api.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+/* Each counter of the barrier sits on its own cache line, so arriving threads do not invalidate the line waiting threads poll */
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define GC_THREAD_BARRIER_CACHE_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define GC_THREAD_BARRIER_CACHE_LINE_SIZE 256
+#else
+#define GC_THREAD_BARRIER_CACHE_LINE_SIZE 64
+#endif
+
+/* Smallest spin budget, in pause instructions, a waiting thread falls back to after parking */
+#define GC_THREAD_BARRIER_SPIN_MINIMUM 16
+
+/**
+ * Barrier the GC threads of a parallel task meet at.
+ *
+ * Arriving threads count themselves in with one atomic add.  A phase ends when its releaser advances the
+ * generation: the last thread to arrive for a plain barrier, or the master for a barrier that releases it
+ * alone first.  Waiters notice the new generation by polling it, which makes the generation a sense that
+ * reverses once per phase without needing to be reset, so the barrier can be reused immediately.
+ *
+ * Waiting threads spin for a while, with a pause instruction between polls, and then park: on the polled word
+ * itself where omrthread supports address waits (a futex on Linux) and on the supplied monitor elsewhere.  Releasers only pay for a wake up when a thread has parked.
+ * How long a thread spins is kept by the caller and adapted after every wait: it doubles when the wait ended
+ * while spinning and halves when the thread had to park, so threads that are usually released quickly
+ * avoid the system call, and threads that are not (more threads than processors, long serial sections)
+ * stop burning processor time.
+ */
+class MM_GCThreadBarrier : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uint8_t _leadingPadding[GC_THREAD_BARRIER_CACHE_LINE_SIZE];
+	volatile uint32_t _arrived; /**< threads that arrived in the current phase */
+	volatile uint32_t _arrivalWaiters; /**< threads parked until _arrived changes */
+	uint8_t _arrivedPadding[GC_THREAD_BARRIER_CACHE_LINE_SIZE - (2 * sizeof(uint32_t))];
+	volatile uint32_t _generation; /**< advanced by each release; waiters poll, and park on, this word */
+	volatile uint32_t _releaseWaiters; /**< threads parked until _generation changes */
+	uint8_t _generationPadding[GC_THREAD_BARRIER_CACHE_LINE_SIZE - (2 * sizeof(uint32_t))];
+	omrthread_monitor_t _monitor; /**< monitor threads park on where there is no address wait */
+	bool _addressWait; /**< true if threads park with omrthread_address_wait() rather than on _monitor */
+	uintptr_t _spinMaximum; /**< upper bound of the spin budget of a waiting thread */
+
+	/*
+	 * Function members
+	 */
+private:
+	static uint32_t addU32(volatile uint32_t *address, uint32_t addend);
+	void park(volatile uint32_t *address, uint32_t value, volatile uint32_t *waiters);
+	void wakeAll(volatile uint32_t *address);
+
+	/**
+	 * Spin, then park, while *address holds value (or, if equal is false, while it does not).
+	 * @param spinLimit[in/out] the spin budget of the calling thread, adapted to how the wait ended; UDATA_MAX before
+	 * the first wait of the thread, which then spins as long as allowed
+	 */
+	void wait(volatile uint32_t *address, uint32_t value, bool equal, volatile uint32_t *waiters, uintptr_t *spinLimit);
+
+public:
+	/**
+	 * @param monitor monitor to park on where there is no address wait; may be NULL if omrthread_address_wait_supported()
+	 * @param spinMaximum upper bound of the spin budget of a waiting thread, 0 to park at once
+	 */
+	void initialize(omrthread_monitor_t monitor, uintptr_t spinMaximum)
+	{
+		_monitor = monitor;
+		_addressWait = (TRUE == omrthread_address_wait_supported());
+		_spinMaximum = spinMaximum;
+	}
+
+	/**
+	 * @return the generation of the current phase, to be read before arrive()
+	 */
+	MMINLINE uint32_t getGeneration() { return _generation; }
+
+	/**
+	 * @return the number of threads that arrived in the current phase
+	 */
+	MMINLINE uint32_t getArrivedCount() { return _arrived; }
+
+	/**
+	 * Count the calling thread in to the current phase.
+	 * @return the number of threads that arrived so far, including the caller
+	 */
+	uint32_t arrive();
+
+	/**
+	 * Wait until the phase of the given generation has been released.
+	 */
+	MMINLINE void
+	waitForRelease(uint32_t generation, uintptr_t *spinLimit)
+	{
+		wait(&_generation, generation, true, &_releaseWaiters, spinLimit);
+	}
+
+	/**
+	 * Wait until threadCount threads arrived in the current phase.
+	 */
+	void waitForArrivals(uint32_t threadCount, uintptr_t *spinLimit);
+
+	/**
+	 * End the current phase and let its waiting threads go.  Only one thread, after every thread arrived, may call this.
+	 */
+	void release();
+
+	/**
+	 * Arrive and wait until threadCount threads arrived; the last of them releases the others.
+	 * @return true for the thread that released the phase
+	 */
+	bool arriveAndWait(uint32_t threadCount, uintptr_t *spinLimit);
+
+	MM_GCThreadBarrier()
+		: MM_BaseNonVirtual()
+		, _arrived(0)
+		, _arrivalWaiters(0)
+		, _generation(0)
+		, _releaseWaiters(0)
+		, _monitor(NULL)
+		, _addressWait(false)
+		, _spinMaximum(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* GCTHREADBARRIER_HPP_ */
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "mmomrhook_internal.h"
+
+#include "HeapCensusManager.hpp"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+MM_HeapCensusManager::MM_HeapCensusManager(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _mergeLock()
+	, _census()
+	, _threadCensus(NULL)
+	, _threadCensusCount(0)
+	, _collecting(false)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_HeapCensusManager *
+MM_HeapCensusManager::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapCensusManager *manager = (MM_HeapCensusManager *)env->getForge()->allocate(sizeof(MM_HeapCensusManager), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != manager) {
+		new(manager) MM_HeapCensusManager(env);
+		if (!manager->initialize(env)) {
+			manager->kill(env);
+			manager = NULL;
+		}
+	}
+	return manager;
+}
+
+void
+MM_HeapCensusManager::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_HeapCensusManager::initialize(MM_EnvironmentBase *env)
+{
+	return _mergeLock.initialize(env, &_extensions->lnrlOptions, "MM_HeapCensusManager:_mergeLock");
+}
+
+void
+MM_HeapCensusManager::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _threadCensus) {
+		env->getForge()->free(_threadCensus);
+		_threadCensus = NULL;
+	}
+	_mergeLock.tearDown();
+}
+
+void
+MM_HeapCensusManager::cycleStart(MM_EnvironmentBase *env)
+{
+	Assert_MM_false(_collecting);
+
+	if (NULL == _threadCensus) {
+		/* the dispatcher is created after the manager, so size the thread tables on first use */
+		uintptr_t count = _extensions->dispatcher->threadCountMaximum();
+		_threadCensus = (MM_HeapCensus *)env->getForge()->allocate(count * sizeof(MM_HeapCensus), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL != _threadCensus) {
+			for (uintptr_t index = 0; index < count; index++) {
+				new(&_threadCensus[index]) MM_HeapCensus();
+			}
+			_threadCensusCount = count;
+		}
+	}
+
+	if (NULL != _threadCensus) {
+		_census.clear();
+		_collecting = true;
+	}
+}
+
+void
+MM_HeapCensusManager::threadStart(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(NULL == env->_heapCensus);
+
+	if (_collecting) {
+		uintptr_t slot = env->getSlaveID();
+		Assert_MM_true(slot < _threadCensusCount);
+		env->_heapCensus = &_threadCensus[slot];
+		env->_heapCensus->clear();
+	}
+}
+
+void
+MM_HeapCensusManager::threadEnd(MM_EnvironmentBase *env)
+{
+	if (NULL != env->_heapCensus) {
+		_mergeLock.acquire();
+		_census.merge(env->_heapCensus);
+		_mergeLock.release();
+		env->_heapCensus = NULL;
+	}
+}
+
+void
+MM_HeapCensusManager::cycleEnd(MM_EnvironmentBase *env, uintptr_t cycleType, bool complete)
+{
+	if (_collecting) {
+		_collecting = false;
+		if (complete) {
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			TRIGGER_J9HOOK_MM_OMR_HEAP_CENSUS(_extensions->omrHookInterface,
+				env->getOmrVMThread(),
+				omrtime_hires_clock(),
+				cycleType,
+				_census._objects,
+				_census._bytes,
+				(void *)&_census);
+		}
+	}
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPCENSUSMANAGER_HPP_)
+#define HEAPCENSUSMANAGER_HPP_
+
+#include "omrcfg.h"
+
+#include "BaseNonVirtual.hpp"
+#include "HeapCensus.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Collects a heap census (see MM_HeapCensus) during stop-the-world global marks and scavenges, when
+ * heapCensusEnabled is set.
+ *
+ * The master thread brackets the collection with cycleStart() and cycleEnd().  In between, each GC thread
+ * calls threadStart() before it visits objects, which points env->_heapCensus at the table of its worker slot,
+ * and threadEnd() once it is done, which merges that table into the census of the cycle.  Collectors count an
+ * object only while env->_heapCensus is set, so threads outside such a collection never pay more than the
+ * NULL check.  At the end of a complete cycle the census is reported through J9HOOK_MM_OMR_HEAP_CENSUS.
+ */
+class MM_HeapCensusManager : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_LightweightNonReentrantLock _mergeLock; /**< protects _census while GC threads merge into it */
+	MM_HeapCensus _census; /**< census of the current, or last, cycle */
+	MM_HeapCensus *_threadCensus; /**< one table per GC worker slot, allocated by the first cycle */
+	uintptr_t _threadCensusCount;
+	volatile bool _collecting; /**< true between cycleStart() and cycleEnd() */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_HeapCensusManager *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start a census.  Called by the master thread before the GC threads are dispatched.
+	 * @param env[in] the master thread
+	 */
+	void cycleStart(MM_EnvironmentBase *env);
+
+	/**
+	 * Attach the calling GC thread to the census of the current cycle, if one is being collected.
+	 * @param env[in] a GC thread
+	 */
+	void threadStart(MM_EnvironmentBase *env);
+
+	/**
+	 * Merge the counts of the calling GC thread into the census of the current cycle and detach the thread.
+	 * @param env[in] a GC thread
+	 */
+	void threadEnd(MM_EnvironmentBase *env);
+
+	/**
+	 * Finish the census.  Called by the master thread once all GC threads are done.
+	 * @param env[in] the master thread
+	 * @param cycleType the cycle type (OMR_GC_CYCLE_TYPE_*) the census was collected by
+	 * @param complete false if the collection did not visit every live object (e.g. the scavenge backed out), in
+	 * which case the census is not reported
+	 */
+	void cycleEnd(MM_EnvironmentBase *env, uintptr_t cycleType, bool complete);
+
+	/**
+	 * @return the census of the current or last cycle
+	 */
+	MMINLINE MM_HeapCensus *getCensus() { return &_census; }
+
+	MM_HeapCensusManager(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+};
+
+#endif /* HEAPCENSUSMANAGER_HPP_ */
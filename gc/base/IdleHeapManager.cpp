@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "IdleHeapManager.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "TLHAllocationSupport.hpp"
+
+MM_IdleHeapManager::MM_IdleHeapManager(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _knownZeroLock()
+	, _knownZeroRangeCount(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_IdleHeapManager *
+MM_IdleHeapManager::newInstance(MM_EnvironmentBase *env)
+{
+	MM_IdleHeapManager *manager = (MM_IdleHeapManager *)env->getForge()->allocate(sizeof(MM_IdleHeapManager), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != manager) {
+		new(manager) MM_IdleHeapManager(env);
+		if (!manager->initialize(env)) {
+			manager->kill(env);
+			manager = NULL;
+		}
+	}
+	return manager;
+}
+
+void
+MM_IdleHeapManager::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IdleHeapManager::initialize(MM_EnvironmentBase *env)
+{
+	return _knownZeroLock.initialize(env, &_extensions->lnrlOptions, "MM_IdleHeapManager:_knownZeroLock");
+}
+
+void
+MM_IdleHeapManager::tearDown(MM_EnvironmentBase *env)
+{
+	_knownZeroLock.tearDown();
+}
+
+uintptr_t
+MM_IdleHeapManager::releasePages(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t releasedBytes = 0;
+
+	/* Only a heap of default size pages is private anonymous memory, for which the port library reports the contents reliably */
+	if (_extensions->heap->getPageSize() == omrvmem_supported_page_sizes()[0]) {
+		uintptr_t flags = _extensions->idleHeapReleaseLazily ? OMRPORT_MMAP_DONT_NEED_LAZY : 0;
+		int32_t rc = omrmmap_dont_need_ex(address, size, flags);
+		if (OMRPORT_MMAP_DONT_NEED_NOT_RELEASED != rc) {
+			releasedBytes = size;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+			/* Concurrent sweep writes to free memory after the collection has ended */
+			if ((OMRPORT_MMAP_DONT_NEED_ZEROED == rc) && (0 != _extensions->batchClearTLH) && !_extensions->isConcurrentSweepEnabled()) {
+				rememberKnownZeroMemory(env, address, (void *)((uintptr_t)address + size));
+			}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+		}
+	}
+
+	if (0 == releasedBytes) {
+		if (_extensions->heap->decommitMemory(address, size, lowValidAddress, highValidAddress)) {
+			releasedBytes = size;
+		}
+	}
+
+	return releasedBytes;
+}
+
+void
+MM_IdleHeapManager::rememberKnownZeroMemory(MM_EnvironmentBase *env, void *base, void *top)
+{
+	_knownZeroLock.acquire();
+	/* Ranges that do not fit are simply cleared again when they are used */
+	if (_knownZeroRangeCount < IDLE_HEAP_MANAGER_KNOWN_ZERO_RANGES) {
+		_knownZeroRanges[_knownZeroRangeCount].base = (uintptr_t)base;
+		_knownZeroRanges[_knownZeroRangeCount].top = (uintptr_t)top;
+		_knownZeroRangeCount += 1;
+	}
+	_knownZeroLock.release();
+}
+
+void *
+MM_IdleHeapManager::claimKnownZeroMemory(MM_EnvironmentBase *env, void *base, void *top)
+{
+	uintptr_t low = (uintptr_t)base;
+	uintptr_t high = (uintptr_t)top;
+	uintptr_t zeroTop = high;
+	bool overlaps = false;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	uintptr_t headerSize = sizeof(MM_HeapLinkedFreeHeaderTLH);
+#else /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	uintptr_t headerSize = sizeof(MM_HeapLinkedFreeHeader);
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+	_knownZeroLock.acquire();
+	uintptr_t index = 0;
+	while (index < _knownZeroRangeCount) {
+		KnownZeroRange *range = &_knownZeroRanges[index];
+		if ((low < range->top) && (high > range->base)) {
+			uintptr_t clearTop = high;
+			if (high <= range->top) {
+				/* Below the range, and a free entry header at the start of the TLH or of the range, may hold data */
+				clearTop = OMR_MIN(high, OMR_MAX(low, range->base) + headerSize);
+			}
+			zeroTop = overlaps ? OMR_MAX(zeroTop, clearTop) : clearTop;
+			overlaps = true;
+			range->base = OMR_MIN(high, range->top);
+		}
+		if (range->base >= range->top) {
+			_knownZeroRangeCount -= 1;
+			*range = _knownZeroRanges[_knownZeroRangeCount];
+		} else {
+			index += 1;
+		}
+	}
+	_knownZeroLock.release();
+
+	return (void *)zeroTop;
+}
+
+void
+MM_IdleHeapManager::forgetKnownZeroMemory(MM_EnvironmentBase *env)
+{
+	if (hasKnownZeroMemory()) {
+		_knownZeroLock.acquire();
+		_knownZeroRangeCount = 0;
+		_knownZeroLock.release();
+	}
+}
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(IDLEHEAPMANAGER_HPP_)
+#define IDLEHEAPMANAGER_HPP_
+
+#include "omrcfg.h"
+
+#include "BaseNonVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+#define IDLE_HEAP_MANAGER_KNOWN_ZERO_RANGES 64
+
+/**
+ * Returns free heap memory to the operating system once the process is idle, and remembers which of it
+ * reads as zero when it is used again.
+ *
+ * Memory pools hand the pages of their free entries to releasePages() after an idle collection.  Pages are
+ * freed lazily (MADV_FREE) where possible, so an idle process loses them only when the system needs the
+ * memory.  Pages dropped right away (MADV_DONTNEED) read as zero afterwards: such ranges are remembered
+ * until the next collection, and TLHs carved out of them are not cleared again.
+ *
+ * A remembered range lies inside one free entry, whose memory pools allocate from the front.  Between
+ * collections, the only bytes written to free memory are free entry headers, so the memory from the start
+ * of the range to its end stays zero except for a header at the start of each TLH that is carved from it.
+ * Every TLH overlapping a range moves the start of the range past its top.
+ */
+class MM_IdleHeapManager : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef struct KnownZeroRange {
+		uintptr_t base;
+		uintptr_t top;
+	} KnownZeroRange;
+
+	MM_GCExtensionsBase *_extensions;
+	MM_LightweightNonReentrantLock _knownZeroLock; /**< protects the known zero ranges */
+	KnownZeroRange _knownZeroRanges[IDLE_HEAP_MANAGER_KNOWN_ZERO_RANGES]; /**< disjoint, unordered */
+	volatile uintptr_t _knownZeroRangeCount;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_IdleHeapManager *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the pages of a free heap range to the operating system.
+	 * @param env[in] the current thread
+	 * @param address[in] heap page aligned start of the range
+	 * @param size[in] heap page aligned size of the range
+	 * @param lowValidAddress[in] lowest address that must stay valid, as for MM_Heap::decommitMemory
+	 * @param highValidAddress[in] highest address that must stay valid, as for MM_Heap::decommitMemory
+	 * @return the number of bytes released
+	 */
+	uintptr_t releasePages(MM_EnvironmentBase *env, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	MMINLINE bool hasKnownZeroMemory() { return 0 != _knownZeroRangeCount; }
+
+	/**
+	 * Account for a TLH carved out of free memory between collections.
+	 * @param env[in] the current thread
+	 * @param base[in] base of the TLH
+	 * @param top[in] top of the TLH
+	 * @return the address up to which the TLH still has to be cleared, top if none of it is known to be zero
+	 */
+	void *claimKnownZeroMemory(MM_EnvironmentBase *env, void *base, void *top);
+
+	/**
+	 * Drop all known zero ranges.  Called at the start of every collection, which may write to free memory.
+	 */
+	void forgetKnownZeroMemory(MM_EnvironmentBase *env);
+
+	MM_IdleHeapManager(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	void rememberKnownZeroMemory(MM_EnvironmentBase *env, void *base, void *top);
+};
+
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+#endif /* IDLEHEAPMANAGER_HPP_ */
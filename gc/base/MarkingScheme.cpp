@@ -35,6 +35,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapCensusManager.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
 #include "Task.hpp"
@@ -97,6 +98,14 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+	_edgeMarking = _extensions->markingEdgeMode;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	/* a mutator may overwrite a slot between push and pop, so concurrent marking stays object based */
+	_edgeMarking = _edgeMarking && !_extensions->concurrentMark;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+#endif /* !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -207,6 +216,9 @@ MM_MarkingScheme::workerSetupForGC(MM_EnvironmentBase *env)
 	env->_markStats.clear();
 	env->_workPacketStats.clear();
 	env->_workStack.reset(env, _workPackets);
+	if (NULL != _extensions->heapCensusManager) {
+		_extensions->heapCensusManager->threadStart(env);
+	}
 	_delegate.workerSetupForGC(env);
 }
 
@@ -214,6 +226,9 @@ void
 MM_MarkingScheme::workerCleanupAfterGC(MM_EnvironmentBase *env)
 {
 	_delegate.workerCleanupAfterGC(env);
+	if (NULL != _extensions->heapCensusManager) {
+		_extensions->heapCensusManager->threadEnd(env);
+	}
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	_extensions->globalGCStats.markStats.merge(&env->_markStats);
 	_extensions->globalGCStats.workPacketStats.merge(&env->_workPacketStats);
@@ -313,7 +328,12 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 #endif /* OMR_GC_LEAF_BITS */
 			fixupForwardedSlot(slotObject);
 
-			inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			if (_edgeMarking && !isLeafSlot) {
+				/* defer the mark bit test (and the load of the target) until the slot is popped */
+				env->_workStack.push(env, (void *)((uintptr_t)slotObject->readAddressFromSlot() | PACKET_EDGE_TAG));
+			} else {
+				inlineMarkObjectNoCheck(env, slotObject->readReferenceFromSlot(), isLeafSlot);
+			}
 		}
 	}
 	return sizeToDo;
@@ -329,13 +349,64 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	uintptr_t prefetchDistance = OMR_MIN(_extensions->markingPrefetchDistance, MAXIMUM_MARKING_PREFETCH_DISTANCE);
+
 	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+		if (0 == prefetchDistance) {
+			void *entry = NULL;
+			while (NULL != (entry = env->_workStack.pop(env))) {
+				omrobjectptr_t objectPtr = resolveWorkStackEntry(env, entry);
+				if (NULL != objectPtr) {
+					env->_markStats._bytesScanned += scanObject(env, objectPtr);
+					env->_markStats._objectsScanned += 1;
+				}
+			}
+		} else {
+			completeScanWithPrefetch(env, prefetchDistance);
+		}
+	} while (_workPackets->handleWorkPacketOverflow(env));
+}
+
+/**
+ * Private internal. Called exclusively from completeScan();
+ * Objects are popped into a small FIFO and prefetched, and each is scanned only once prefetchDistance
+ * later objects have been popped behind it, so the header and slots are usually in cache by then.
+ * The FIFO is topped up with popNoWait() only: a thread must never wait for work in the termination
+ * protocol while it still holds unscanned objects, so the blocking pop() is used once the FIFO is empty.
+ */
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance)
+{
+	void *fifo[MAXIMUM_MARKING_PREFETCH_DISTANCE];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	while (true) {
+		void *entry = NULL;
+		while ((count < prefetchDistance) && (NULL != (entry = env->_workStack.popNoWait(env)))) {
+			prefetchWorkStackEntry(entry);
+			fifo[(head + count) % MAXIMUM_MARKING_PREFETCH_DISTANCE] = entry;
+			count += 1;
+		}
+
+		if (0 == count) {
+			/* nothing in flight: wait for work, or return NULL when all threads are done */
+			entry = env->_workStack.pop(env);
+			if (NULL == entry) {
+				break;
+			}
+		} else {
+			entry = fifo[head];
+			head = (head + 1) % MAXIMUM_MARKING_PREFETCH_DISTANCE;
+			count -= 1;
+		}
+
+		omrobjectptr_t objectPtr = resolveWorkStackEntry(env, entry);
+		if (NULL != objectPtr) {
 			env->_markStats._bytesScanned += scanObject(env, objectPtr);
 			env->_markStats._objectsScanned += 1;
 		}
-	} while (_workPackets->handleWorkPacketOverflow(env));
+	}
 }
 
 /****************************************
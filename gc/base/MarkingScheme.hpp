@@ -53,6 +53,7 @@ class MM_MarkingScheme : public MM_BaseVirtual
 	 */
 private:
 	OMR_VM *_omrVM;
+	bool _edgeMarking; /**< cached markingEdgeMode, cleared when marking runs concurrently */
 
 protected:
 	MM_GCExtensionsBase *_extensions;
@@ -85,6 +86,59 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from completeScan() when markingPrefetchDistance is non-zero;
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance);
+
+	/**
+	 * Hint the processor to start loading the header of an object which is about to be scanned.
+	 */
+	MMINLINE void
+	prefetchObject(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch((void *)objectPtr);
+#endif /* defined(__GNUC__) || defined(__clang__) */
+	}
+
+	/**
+	 * Prefetch what scanning a popped work stack entry will touch first: the object itself, or for an
+	 * edge the target object and its mark map word.
+	 */
+	MMINLINE void
+	prefetchWorkStackEntry(void *entry)
+	{
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+		/* edge marking is not supported with the experimental object scanner */
+		prefetchObject((omrobjectptr_t)entry);
+#else /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
+		if (isEdgeEntry(entry)) {
+			GC_SlotObject slotObject(_omrVM, (fomrobject_t *)((uintptr_t)entry & ~(uintptr_t)PACKET_EDGE_TAG));
+			omrobjectptr_t objectPtr = slotObject.readReferenceFromSlot();
+			if (NULL != objectPtr) {
+				prefetchObject(objectPtr);
+				prefetchObject((omrobjectptr_t)&_markMap->getHeapMapBits()[_markMap->getSlotIndex(objectPtr)]);
+			}
+		} else {
+			prefetchObject((omrobjectptr_t)entry);
+		}
+#endif /* defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
+	}
+
+	/**
+	 * Count an object marked by the calling thread in its heap census, if one is being collected. This reads
+	 * the header of the object, which marking would otherwise not touch for leaf objects.
+	 */
+	MMINLINE void
+	censusMarkedObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if (NULL != env->_heapCensus) {
+			GC_ObjectModel *objectModel = &_extensions->objectModel;
+			env->_heapCensus->add(objectModel->getObjectCensusKey(objectPtr), objectModel->getConsumedSizeInBytesWithHeader(objectPtr));
+		}
+	}
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -173,6 +227,7 @@ public:
 		}
 
 		env->_markStats._objectsMarked += 1;
+		censusMarkedObject(env, objectPtr);
 
 		return true;
 	}
@@ -229,6 +284,47 @@ public:
 		return marked;
 	}
 
+	/**
+	 * @return true if a work stack entry is an edge pushed by edge marking, rather than an object or array split
+	 */
+	MMINLINE bool
+	isEdgeEntry(void *entry)
+	{
+		return PACKET_EDGE_TAG == ((uintptr_t)entry & (PACKET_EDGE_TAG | PACKET_ARRAY_SPLIT_TAG));
+	}
+
+	/**
+	 * Turn an entry popped from the work stack into the object to scan. Objects are returned as is.
+	 * Edges (slot addresses tagged with PACKET_EDGE_TAG) have their target marked here, and the target
+	 * is returned only if this call marked it.
+	 *
+	 * @param[in] env calling thread environment
+	 * @param[in] entry work stack entry
+	 * @return the object to scan, or NULL if the entry needs no further work
+	 */
+	MMINLINE omrobjectptr_t
+	resolveWorkStackEntry(MM_EnvironmentBase *env, void *entry)
+	{
+		omrobjectptr_t objectPtr = (omrobjectptr_t)entry;
+#if !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+		if (isEdgeEntry(entry)) {
+			GC_SlotObject slotObject(_omrVM, (fomrobject_t *)((uintptr_t)entry & ~(uintptr_t)PACKET_EDGE_TAG));
+			fixupForwardedSlot(&slotObject);
+			objectPtr = slotObject.readReferenceFromSlot();
+			if (NULL != objectPtr) {
+				assertSaneObjectPtr(env, objectPtr);
+				if (_markMap->atomicSetBit(objectPtr)) {
+					env->_markStats._objectsMarked += 1;
+					censusMarkedObject(env, objectPtr);
+				} else {
+					objectPtr = NULL;
+				}
+			}
+		}
+#endif /* !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER) */
+		return objectPtr;
+	}
+
 	uintptr_t numMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
 	uintptr_t setMarkBitsInRange(MM_EnvironmentBase *env, void *heapBase, void *heapTop, bool clear);
 	uintptr_t numHeapBytesPerMarkMapByte() { return (_markMap->getObjectGrain() * BITS_PER_BYTE); };
@@ -336,6 +432,7 @@ public:
 	MM_MarkingScheme(MM_EnvironmentBase *env)
 		: MM_BaseVirtual()
 		, _omrVM(env->getOmrVM())
+		, _edgeMarking(false)
 		, _extensions(env->getExtensions())
 		, _delegate()
 		, _markMap(NULL)
@@ -20,6 +20,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "MemoryManager.hpp"
 
@@ -73,6 +76,11 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	if ((0 != extensions->heapHugePageSize) && !isLargePage(env, pageSize)) {
+		/* Explicit large pages need no advice: ask for transparent huge pages behind the default pages */
+		options |= OMRPORT_VMEM_TRANSPARENT_HUGE_PAGES;
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -536,6 +544,49 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+uintptr_t
+MM_MemoryManager::getTransparentHugePageBackedSize(MM_EnvironmentBase* env, void* lowAddress, void* highAddress)
+{
+	uintptr_t backedSize = 0;
+#if defined(LINUX)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	intptr_t fd = omrfile_open("/proc/self/smaps", EsOpenRead, 0);
+	if (-1 != fd) {
+		char buffer[4096];
+		uintptr_t filled = 0;
+		bool inRange = false;
+		intptr_t bytesRead = 0;
+		while (0 < (bytesRead = omrfile_read(fd, buffer + filled, sizeof(buffer) - 1 - filled))) {
+			filled += (uintptr_t)bytesRead;
+			buffer[filled] = '\0';
+			char* line = buffer;
+			char* lineEnd = NULL;
+			while (NULL != (lineEnd = strchr(line, '\n'))) {
+				*lineEnd = '\0';
+				if (isdigit(line[0]) || islower(line[0])) {
+					/* A mapping starts with its "low-high" address range in hex; field names are capitalized */
+					char* cursor = NULL;
+					uintptr_t mappingLow = (uintptr_t)strtoull(line, &cursor, 16);
+					uintptr_t mappingHigh = ('-' == *cursor) ? (uintptr_t)strtoull(cursor + 1, NULL, 16) : 0;
+					inRange = (mappingLow < (uintptr_t)highAddress) && (mappingHigh > (uintptr_t)lowAddress);
+				} else if (inRange && (0 == strncmp(line, "AnonHugePages:", 14))) {
+					backedSize += (uintptr_t)strtoull(line + 14, NULL, 10) * 1024;
+				}
+				line = lineEnd + 1;
+			}
+			/* Carry the incomplete last line over to the next read; drop it if it fills the whole buffer */
+			filled = strlen(line);
+			if (filled >= (sizeof(buffer) - 1)) {
+				filled = 0;
+			}
+			memmove(buffer, line, filled);
+		}
+		omrfile_close(fd);
+	}
+#endif /* defined(LINUX) */
+	return backedSize;
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
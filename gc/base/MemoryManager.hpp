@@ -191,6 +191,18 @@ public:
 	 */
 	bool decommitMemory(MM_MemoryHandle* handle, void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 
+	/**
+	 * Measure how much memory in mappings overlapping an address range is backed by transparent huge pages.
+	 * Implemented for Linux only, where it is read from /proc/self/smaps; the kernel walks the page tables
+	 * of every mapping to produce that file, so this is meant for occasional reporting only.
+	 *
+	 * @param env environment
+	 * @param lowAddress start of the range
+	 * @param highAddress end of the range
+	 * @return bytes backed by transparent huge pages, 0 if unknown
+	 */
+	uintptr_t getTransparentHugePageBackedSize(MM_EnvironmentBase* env, void* lowAddress, void* highAddress);
+
 #if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
@@ -1671,9 +1671,13 @@ uintptr_t
 MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 {
 	uintptr_t releasedBytes = 0;
-	_heapLock.acquire();
-	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
-	_heapLock.release();
+	void* resumeAddress = NULL;
+	/* drop the lock between slices to let allocating threads in */
+	do {
+		_heapLock.acquire();
+		releasedBytes += releaseFreeEntryMemoryPages(env, _heapFreeList, &resumeAddress);
+		_heapLock.release();
+	} while (NULL != resumeAddress);
 	return releasedBytes;
 }
 #endif
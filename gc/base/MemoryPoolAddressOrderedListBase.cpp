@@ -38,6 +38,7 @@
 #include "MemorySubSpace.hpp"
 //#include "mmhook_internal.h"
 #include "HeapRegionDescriptor.hpp"
+#include "IdleHeapManager.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
@@ -186,11 +187,17 @@ MM_MemoryPoolAddressOrderedListBase::abandonMemoryInPool(MM_EnvironmentBase* env
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 uintptr_t
-MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry)
+MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, void** resumeAddress)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t sliceStartTime = omrtime_hires_clock();
 	uintptr_t releasedMemory = 0;
 	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
 	uintptr_t pageSize = env->getExtensions()->heap->getPageSize();
+	/* the list may have changed since the previous slice, so find the first entry not yet visited by address */
+	while ((NULL != currentFreeEntry) && ((void*)currentFreeEntry < *resumeAddress)) {
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
 	while (NULL != currentFreeEntry) {
 		/* skip entry less than page size */
 		if (pageSize <= currentFreeEntry->getSize()) {
@@ -208,14 +215,17 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 				addressBase += commitPagesCount * pageSize;
 				/* now decommit pages of memory */
 				if (0 < decommitPagesCount) {
-					if (_extensions->heap->decommitMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
-						releasedMemory += decommitPagesCount * pageSize;
-					}
+					releasedMemory += _extensions->idleHeapManager->releasePages(env, (void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd());
 				}
 			}
 		}
 		currentFreeEntry = currentFreeEntry->getNext();
+		/* bound the time the caller holds the free list lock */
+		if ((NULL != currentFreeEntry) && (omrtime_hires_delta(sliceStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS) >= _extensions->idleHeapReleaseSliceMicros)) {
+			break;
+		}
 	}
+	*resumeAddress = (void*)currentFreeEntry;
 	return releasedMemory;
 }
 #endif
@@ -241,7 +241,15 @@ public:
 
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase* env)=0;
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+	/**
+	 * Release the free pages of the entries of a free list to the OS, for at most one time slice
+	 * (idleHeapReleaseSliceMicros).  The caller holds the lock of the list.
+	 * @param freeEntry[in] head of the free list
+	 * @param resumeAddress[in/out] entries below this address are skipped; on return, the address of the
+	 * first entry left for the next slice, or NULL once the end of the list was reached
+	 * @return bytes released
+	 */
+	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, void** resumeAddress);
 #endif
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
@@ -1296,10 +1296,14 @@ MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase*
 	uintptr_t releasedMemory = 0;
 
 	for (uintptr_t i = 0; i < _heapFreeListCountExtended; i++) {
-		_heapFreeLists[i]._lock.acquire();
-		_heapFreeLists[i]._timesLocked += 1;
-		releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList);
-		_heapFreeLists[i]._lock.release();
+		void* resumeAddress = NULL;
+		/* drop the lock between slices to let allocating threads in */
+		do {
+			_heapFreeLists[i]._lock.acquire();
+			_heapFreeLists[i]._timesLocked += 1;
+			releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList, &resumeAddress);
+			_heapFreeLists[i]._lock.release();
+		} while (NULL != resumeAddress);
 	}
 
 	return releasedMemory;
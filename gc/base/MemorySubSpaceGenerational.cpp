@@ -328,7 +328,7 @@ MM_MemorySubSpaceGenerational::counterBalanceContract(
 uintptr_t
 MM_MemorySubSpaceGenerational::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 {
-	return _memorySubSpaceOld->releaseFreeMemoryPages(env);
+	return _memorySubSpaceOld->releaseFreeMemoryPages(env) + _memorySubSpaceNew->releaseFreeMemoryPages(env);
 }
 #endif
 
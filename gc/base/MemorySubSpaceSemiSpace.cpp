@@ -632,6 +632,15 @@ MM_MemorySubSpaceSemiSpace::poisonEvacuateSpace()
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */	
 }
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+uintptr_t
+MM_MemorySubSpaceSemiSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+{
+	/* Between scavenges the survivor space is one free entry that is not used until the next scavenge */
+	return _memorySubSpaceAllocate->releaseFreeMemoryPages(env) + _memorySubSpaceSurvivor->releaseFreeMemoryPages(env);
+}
+#endif
+
 void
 MM_MemorySubSpaceSemiSpace::tilt(MM_EnvironmentBase *env, uintptr_t allocateSpaceSize, uintptr_t survivorSpaceSize)
 {
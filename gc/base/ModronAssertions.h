@@ -113,6 +113,15 @@ do {\
 	}\
 } while (false)
 
+/* Five printed parameters macro */
+#define Assert_GC_true_with_message5(__env__,__condition,__message,__parameter1,__parameter2,__parameter3,__parameter4,__parameter5) \
+do {\
+	if(!(__condition)) {\
+		omrGcDebugAssertionOutput(__env__->getPortLibrary(), __env__->getOmrVMThread(), __message, __parameter1, __parameter2, __parameter3, __parameter4, __parameter5);\
+		Assert_MM_unreachable();\
+	}\
+} while (false)
+
 #define Assert_MM_objectAligned(__env__,__pointer) \
 do {\
 	if((uintptr_t)(__pointer) & (__env__->getObjectAlignmentInBytes() - 1)) {\
@@ -131,6 +140,7 @@ do {\
 #define Assert_GC_true_with_message2(__env__,__condition,__message,__parameter1,__parameter2) Assert_MM_true(__condition)
 #define Assert_GC_true_with_message3(__env__,__condition,__message,__parameter1,__parameter2,__parameter3) Assert_MM_true(__condition)
 #define Assert_GC_true_with_message4(__env__,__condition,__message,__parameter1,__parameter2,__parameter3,__parameter4) Assert_MM_true(__condition)
+#define Assert_GC_true_with_message5(__env__,__condition,__message,__parameter1,__parameter2,__parameter3,__parameter4,__parameter5) Assert_MM_true(__condition)
 #define Assert_MM_objectAligned(__env__,__pointer) Assert_MM_true_internal((uintptr_t)(__pointer) & (__env__->getObjectAlignmentInBytes() - 1))
 #endif /* defined(OMR_GC_DEBUG_ASSERTS) */
 
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(NONTEMPORALCOPY_HPP_)
+#define NONTEMPORALCOPY_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__SSE2__) */
+
+/* Bytes moved per iteration of the streaming loop (one cache line) */
+#define NON_TEMPORAL_COPY_BLOCK_SIZE 64
+/* How far ahead of the streaming loop the source is prefetched */
+#define NON_TEMPORAL_COPY_PREFETCH_DISTANCE (8 * NON_TEMPORAL_COPY_BLOCK_SIZE)
+
+/**
+ * Copy large blocks of memory without pulling the destination (or, as far as the hardware
+ * allows, the source) into the cache. Used for big survivors, whose copies would otherwise
+ * evict the working set of the threads still scanning.
+ *
+ * Where non-temporal stores are not available this is a plain memcpy.
+ * @ingroup GC_Base_Core
+ */
+class MM_NonTemporalCopy
+{
+public:
+	/**
+	 * Copy size bytes from source to destination. The regions must not overlap. All stores are
+	 * globally visible, in order with stores that follow, when this returns.
+	 */
+	static MMINLINE void
+	copy(void *destination, const void *source, uintptr_t size)
+	{
+#if defined(__SSE2__)
+		uint8_t *dst = (uint8_t *)destination;
+		const uint8_t *src = (const uint8_t *)source;
+
+		/* streaming stores must be 16 byte aligned; objects are only guaranteed to be 8 byte aligned */
+		uintptr_t head = OMR_MIN((0 - (uintptr_t)dst) & (sizeof(__m128i) - 1), size);
+		memcpy(dst, src, head);
+		dst += head;
+		src += head;
+		size -= head;
+
+		while (size >= NON_TEMPORAL_COPY_BLOCK_SIZE) {
+			/* the source is dead once copied, so do not let the prefetch displace anything useful */
+			_mm_prefetch((const char *)src + NON_TEMPORAL_COPY_PREFETCH_DISTANCE, _MM_HINT_NTA);
+			__m128i block0 = _mm_loadu_si128((const __m128i *)src);
+			__m128i block1 = _mm_loadu_si128((const __m128i *)src + 1);
+			__m128i block2 = _mm_loadu_si128((const __m128i *)src + 2);
+			__m128i block3 = _mm_loadu_si128((const __m128i *)src + 3);
+			_mm_stream_si128((__m128i *)dst, block0);
+			_mm_stream_si128((__m128i *)dst + 1, block1);
+			_mm_stream_si128((__m128i *)dst + 2, block2);
+			_mm_stream_si128((__m128i *)dst + 3, block3);
+			dst += NON_TEMPORAL_COPY_BLOCK_SIZE;
+			src += NON_TEMPORAL_COPY_BLOCK_SIZE;
+			size -= NON_TEMPORAL_COPY_BLOCK_SIZE;
+		}
+
+		memcpy(dst, src, size);
+
+		/* streaming stores are weakly ordered; fence them before the copy can be published to other threads */
+		_mm_sfence();
+#else /* defined(__SSE2__) */
+		memcpy(destination, source, size);
+#endif /* defined(__SSE2__) */
+	}
+};
+
+#endif /* NONTEMPORALCOPY_HPP_ */
@@ -97,6 +97,7 @@ private:
 protected:
 	uintptr_t _objectAlignmentInBytes; 	/**< cached copy of heap object alignment factor, in bytes */
 	uintptr_t _objectAlignmentShift; 	/**< cached copy of heap object alignment shift, must be log2(_objectAlignmentInBytes)  */
+	uintptr_t _compressedPointersShift;	/**< cached copy of OMR_VM::_compressedPointersShift, 0 unless heap slots hold compressed references */
 
 public:
 
@@ -144,7 +145,7 @@ public:
 	MMINLINE OMRClient::GC::ObjectScanner
 	makeObjectScanner()
 	{
-		return _delegate.makeObjectScanner();
+		return _delegate.makeObjectScanner(_compressedPointersShift);
 	}
 #endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
 
@@ -230,6 +231,17 @@ public:
 		return _delegate.getObjectSizeInBytesWithHeader(objectPtr);
 	}
 
+	/**
+	 * Returns the key that identifies the type of an object in a heap census.
+	 * @param objectPtr Pointer to an object
+	 * @return The census key of the object
+	 */
+	MMINLINE uintptr_t
+	getObjectCensusKey(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getObjectCensusKey(objectPtr);
+	}
+
 	/**
 	 * Determine the total size of an object, in bytes, including padding bytes added to bring tail
 	 * of object into heap alignment (see GC_ObjectModelBase::adjustSizeInBytes()). If the object has
@@ -339,6 +351,7 @@ public:
 	{
 		_objectAlignmentInBytes = OMR_MAX((uintptr_t)1 << omrVM->_compressedPointersShift, OMR_MINIMUM_OBJECT_ALIGNMENT);
 		_objectAlignmentShift = OMR_MAX(omrVM->_compressedPointersShift, OMR_MINIMUM_OBJECT_ALIGNMENT_SHIFT);
+		_compressedPointersShift = omrVM->_compressedPointersShift;
 
 		omrVM->_objectAlignmentInBytes = _objectAlignmentInBytes;
 		omrVM->_objectAlignmentShift = _objectAlignmentShift;
@@ -362,6 +375,15 @@ public:
 		return _objectAlignmentShift;
 	}
 
+	/**
+	 * Get the run-time shift applied to references stored in heap slots (0 if slots are full width)
+	 */
+	MMINLINE uintptr_t
+	getCompressedPointersShift()
+	{
+		return _compressedPointersShift;
+	}
+
 	/**
 	 * Returns TRUE if an object is indexable, FALSE otherwise. Languages that support indexable objects
 	 * (e.g. arrays) must provide an implementation that distinguishes indexable from scalar objects.
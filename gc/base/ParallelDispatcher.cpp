@@ -468,6 +468,7 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 
 	task->setThreadCount(_activeThreadCount);
 	task->setSynchronizeMutex(_synchronizeMutex);
+	task->setSynchronizeSpinMaximum(_extensions->gcThreadBarrierSpinMaximum);
 	
 	for(uintptr_t index=0; index < _activeThreadCount; index++) {
 		_statusTable[index] = slave_status_reserved;
@@ -34,6 +34,7 @@
 #include "MarkMap.hpp"
 #include "MarkMapSegmentChunkIterator.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ParallelGlobalGC.hpp"
 #include "ParallelObjectHeapIterator.hpp"
 #include "ObjectModel.hpp"
@@ -107,8 +108,9 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 
 	/* determine the size of the segment chunks to use for parallel walks */
 	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	bool markMapValid = _markMap->isMarkMapValid();
 	uintptr_t heapChunkFactor = 1;
-	if ((threadCount > 1) && _markMap->isMarkMapValid()) {
+	if ((threadCount > 1) && markMapValid) {
 		heapChunkFactor = threadCount * 8;
 	}
 	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
@@ -125,11 +127,21 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalk
 
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
-			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
-			omrobjectptr_t object = NULL;
-			while ((object = objectHeapIterator.nextObject()) != NULL) {
-				function(omrVMThread, region, object, userData);
-				objectsWalked += 1;
+			if (markMapValid) {
+				GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(), region->getHighAddress(), _markMap, parallelChunkSize);
+				omrobjectptr_t object = NULL;
+				while ((object = objectHeapIterator.nextObject()) != NULL) {
+					function(omrVMThread, region, object, userData);
+					objectsWalked += 1;
+				}
+			} else if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				/* chunks start at marked objects, so without a valid mark map each region is walked whole by one thread */
+				GC_ObjectHeapIteratorAddressOrderedList objectHeapIterator(extensions, region, false);
+				omrobjectptr_t object = NULL;
+				while ((object = objectHeapIterator.nextObject()) != NULL) {
+					function(omrVMThread, region, object, userData);
+					objectsWalked += 1;
+				}
 			}
 		}
 	}
@@ -70,6 +70,23 @@ MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 	return envWorkUnitIndex == envWorkUnitToHandle;
 }
 
+void
+MM_ParallelTask::arriveAtSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller)
+{
+	/* the first thread to arrive records the sync point, the others check they arrived at the same one */
+	uintptr_t workUnitIndex = env->getWorkUnitIndex();
+	const char *syncPointUniqueId = (const char *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_syncPointUniqueId, (uintptr_t)NULL, (uintptr_t)id);
+	uintptr_t syncPointWorkUnitIndex = MM_AtomicOperations::lockCompareExchange(&_syncPointWorkUnitIndex, UDATA_MAX, workUnitIndex);
+	if (NULL == syncPointUniqueId) {
+		_lastSyncPointUniqueId = id;
+	}
+
+	Assert_GC_true_with_message5(env, (NULL == syncPointUniqueId) || (syncPointUniqueId == id),
+		"%s at %p from %s: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, caller, id, syncPointUniqueId);
+	Assert_GC_true_with_message5(env, (UDATA_MAX == syncPointWorkUnitIndex) || (syncPointWorkUnitIndex == workUnitIndex),
+		"%s at %p from %s: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, caller, workUnitIndex, syncPointWorkUnitIndex);
+}
+
 void
 MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 {
@@ -77,34 +94,20 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
-		omrthread_monitor_enter(_synchronizeMutex);
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
 
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
-		} else {
-			Assert_GC_true_with_message4(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreads: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message4(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreads: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
+		uint32_t generation = _synchronizeBarrier.getGeneration();
+		arriveAtSyncPoint(env, id, "synchronizeGCThreads");
 
-		_synchronizeCount += 1;
-
-		if(_synchronizeCount == _threadCount) {
-			_synchronizeCount = 0;
-			_synchronizeIndex += 1;
-			omrthread_monitor_notify_all(_synchronizeMutex);
+		if(_threadCount == _synchronizeBarrier.arrive()) {
+			leaveSyncPoint();
+			_synchronizeBarrier.release();
 		} else {
-			volatile uintptr_t index = _synchronizeIndex;
-
-			do {
-				omrthread_monitor_wait(_synchronizeMutex);
-			} while(index == _synchronizeIndex);
+			_synchronizeBarrier.waitForRelease(generation, &env->_syncSpinLimit);
 		}
-		omrthread_monitor_exit(_synchronizeMutex);
 
+		env->_taskPhaseStats.addToSyncStallTime(startTime, omrtime_hires_clock());
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -114,53 +117,33 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMasterThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
-		volatile uintptr_t index = _synchronizeIndex;
-
-		omrthread_monitor_enter(_synchronizeMutex);
+		uint32_t generation = _synchronizeBarrier.getGeneration();
+		arriveAtSyncPoint(env, id, "synchronizeGCThreadsAndReleaseMaster");
 
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
+		_synchronizeBarrier.arrive();
+		if(env->isMasterThread()) {
+			/* the master goes on alone once everyone is here, and lets the others go in releaseSynchronizedGCThreads */
+			_synchronizeBarrier.waitForArrivals((uint32_t)_threadCount, &env->_syncSpinLimit);
+			isMasterThread = true;
+			_synchronized = true;
 		} else {
-			Assert_GC_true_with_message4(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreadsAndReleaseMaster: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message4(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreadsAndReleaseMaster: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
-
-		_synchronizeCount += 1;
-		if(_synchronizeCount == _threadCount) {
-			if(env->isMasterThread()) {
-				omrthread_monitor_exit(_synchronizeMutex);
-				isMasterThread = true;
-				_synchronized = true;
-				goto done;
-			}
-			omrthread_monitor_notify_all(_synchronizeMutex);
+			_synchronizeBarrier.waitForRelease(generation, &env->_syncSpinLimit);
 		}
-
-		while(index == _synchronizeIndex) {
-			if(env->isMasterThread() && (_synchronizeCount == _threadCount)) {
-				omrthread_monitor_exit(_synchronizeMutex);
-				isMasterThread = true;
-				_synchronized = true;
-				goto done;
-			}
-			omrthread_monitor_wait(_synchronizeMutex);
-		}
-		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
 		isMasterThread = true;
 	}
 
-done:
+	if(1 < _totalThreadCount) {
+		env->_taskPhaseStats.addToSyncStallTime(startTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Exit(env->getLanguageVMThread());
 	return isMasterThread;	
 }
@@ -169,45 +152,31 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
-		volatile uintptr_t index = _synchronizeIndex;
-		uintptr_t workUnitIndex = env->getWorkUnitIndex();
-
-		omrthread_monitor_enter(_synchronizeMutex);
-
-		/*check synchronization point*/
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = workUnitIndex;
-		} else {
-			Assert_GC_true_with_message4(env, _syncPointUniqueId == id,
-				"%s at %p from synchronizeGCThreadsAndReleaseSingleThread: call from (%s), expected (%s)\n", getBaseVirtualTypeId(), this, id, _syncPointUniqueId);
-			Assert_GC_true_with_message4(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from synchronizeGCThreadsAndReleaseSingleThread: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-		}
+		uint32_t generation = _synchronizeBarrier.getGeneration();
+		arriveAtSyncPoint(env, id, "synchronizeGCThreadsAndReleaseSingleThread");
 
-		_synchronizeCount += 1;
-		if(_synchronizeCount == _threadCount) {
-			omrthread_monitor_exit(_synchronizeMutex);
+		if(_threadCount == _synchronizeBarrier.arrive()) {
+			/* the last thread to arrive goes on alone, and lets the others go in releaseSynchronizedGCThreads */
 			isReleasedThread = true;
 			_synchronized = true;
-			goto done;
+		} else {
+			_synchronizeBarrier.waitForRelease(generation, &env->_syncSpinLimit);
 		}
-
-		do {
-			omrthread_monitor_wait(_synchronizeMutex);
-		} while(index == _synchronizeIndex);
-		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
 		isReleasedThread = true;
 	}
 
-done:
+	if(1 < _totalThreadCount) {
+		env->_taskPhaseStats.addToSyncStallTime(startTime, omrtime_hires_clock());
+	}
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -223,18 +192,13 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase *env)
 	Assert_GC_true_with_message2(env, _synchronized, "%s at %p from releaseSynchronizedGCThreads: call for non-synchronized\n", getBaseVirtualTypeId(), this);
 	/* Could not have gotten here unless all other threads are sync'd - don't check, just release */
 	_synchronized = false;
-	omrthread_monitor_enter(_synchronizeMutex);
-	_synchronizeCount = 0;
-	_synchronizeIndex += 1;
-	omrthread_monitor_notify_all(_synchronizeMutex);
-	omrthread_monitor_exit(_synchronizeMutex);
+	leaveSyncPoint();
+	_synchronizeBarrier.release();
 }
 
 void
 MM_ParallelTask::complete(MM_EnvironmentBase *env)
 {
-	const char *id = UNIQUE_ID;
-
 	/* Update this slave thread's CPU time */
 	if(!env->isMasterThread()) {
 		env->_slaveThreadCpuTimeNanos = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
@@ -247,33 +211,27 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	} else {
 		omrthread_monitor_enter(_synchronizeMutex);
 
-		if (0 == _synchronizeCount) {
-			_syncPointUniqueId = id;
-			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
-		} else {
-			Assert_GC_true_with_message3(env, _syncPointUniqueId == id,
-				"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, _syncPointUniqueId);
-			/*
-			 * MM_ParallelScrubCardTableTask is implemented to be aborted if it takes too much time
-			 * An abortion left work unit counters in unpredictable state so it would trigger this assertion
-			 * Temporary commenting out
-			 */
-			/*
-			Assert_GC_true_with_message4(env, _syncPointWorkUnitIndex == env->getWorkUnitIndex(),
-				"%s at %p from complete: call with syncPointWorkUnitIndex %zu, expected %zu\n", getBaseVirtualTypeId(), this, env->getWorkUnitIndex(), _syncPointWorkUnitIndex);
-			*/
-		}
+		/*
+		 * Only the work unit index is not checked: MM_ParallelScrubCardTableTask is implemented to be aborted if it
+		 * takes too much time, and an abort leaves the work unit counters in an unpredictable state.
+		 */
+		Assert_GC_true_with_message3(env, 0 == _synchronizeBarrier.getArrivedCount(),
+			"%s at %p from complete: reach end of the task however threads are waiting at (%s)\n", getBaseVirtualTypeId(), this, _lastSyncPointUniqueId);
 
-		_synchronizeCount += 1;
 		_threadCount -= 1;
 	
 		MM_Task::complete(env);
 	
 		if(env->isMasterThread()) {
 			/* Synchronization on exit - cannot delete the task object until all threads are done with it */
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t startTime = omrtime_hires_clock();
 			while(0 != _threadCount) {
 				omrthread_monitor_wait(_synchronizeMutex);
 			}
+			uint64_t completeStallTime = omrtime_hires_clock() - startTime;
+			_phaseStats._completeStallTime += completeStallTime;
+			_phaseStats._totalTime += completeStallTime;
 		} else {
 			if(0 == _threadCount) {
 				omrthread_monitor_notify_all(_synchronizeMutex);
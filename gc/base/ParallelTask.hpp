@@ -33,6 +33,7 @@
 #include "omrthread.h"
 
 #include "AtomicOperations.hpp"
+#include "GCThreadBarrier.hpp"
 #include "Task.hpp"
 
 class MM_EnvironmentBase;
@@ -49,16 +50,17 @@ class MM_ParallelTask : public MM_Task
 private:
 protected:
 	bool _synchronized;
-	const char *_syncPointUniqueId;
-	uintptr_t _syncPointWorkUnitIndex; /**< The _workUnitIndex of the first thread to sync. All threads should have the same index once sync'ed. */
+	const char * volatile _syncPointUniqueId; /**< id of the sync point threads are arriving at, NULL between sync points */
+	volatile uintptr_t _syncPointWorkUnitIndex; /**< The _workUnitIndex of the first thread to sync. All threads should have the same index once sync'ed. UDATA_MAX between sync points. */
+	const char *_lastSyncPointUniqueId; /**< id of the most recent sync point, kept after the threads leave it, for diagnostics */
 
 	uintptr_t _totalThreadCount;
 	volatile uintptr_t _threadCount;
 	
 	volatile uintptr_t _workUnitIndex;
-	volatile uintptr_t _synchronizeIndex;
-	volatile uintptr_t _synchronizeCount;
-	omrthread_monitor_t _synchronizeMutex;
+	MM_GCThreadBarrier _synchronizeBarrier; /**< barrier the threads of the task meet at in the synchronizeGCThreads family */
+	omrthread_monitor_t _synchronizeMutex; /**< protects task completion, and is what threads park on where the barrier has no address wait */
+	uintptr_t _synchronizeSpinMaximum;
 public:
 	
 	/*
@@ -73,7 +75,16 @@ public:
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	virtual bool synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id, uint64_t *stallTime);
 	
-	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex) { _synchronizeMutex = synchronizeMutex; }
+	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
+	{
+		_synchronizeMutex = synchronizeMutex;
+		_synchronizeBarrier.initialize(_synchronizeMutex, _synchronizeSpinMaximum);
+	}
+	MMINLINE virtual void setSynchronizeSpinMaximum(uintptr_t spinMaximum)
+	{
+		_synchronizeSpinMaximum = spinMaximum;
+		_synchronizeBarrier.initialize(_synchronizeMutex, _synchronizeSpinMaximum);
+	}
 	virtual void complete(MM_EnvironmentBase *env);
 
 	/**
@@ -87,6 +98,25 @@ public:
 	
 	virtual bool isSynchronized();
 
+private:
+	/**
+	 * Record the sync point the calling thread arrives at, or check it against the one the first thread recorded.
+	 * @param caller name of the synchronizeGCThreads variant, for the assertion message
+	 */
+	void arriveAtSyncPoint(MM_EnvironmentBase *env, const char *id, const char *caller);
+
+	/**
+	 * Forget the sync point, before the barrier lets the threads go on to the next one.
+	 */
+	MMINLINE void
+	leaveSyncPoint()
+	{
+		_syncPointUniqueId = NULL;
+		_syncPointWorkUnitIndex = UDATA_MAX;
+	}
+
+public:
+
 	/**
 	 * Create a ParallelTask object.
 	 */
@@ -94,13 +124,14 @@ public:
 		MM_Task(env, dispatcher)
 		,_synchronized(false)
 		,_syncPointUniqueId(NULL)
-		,_syncPointWorkUnitIndex(0)
+		,_syncPointWorkUnitIndex(UDATA_MAX)
+		,_lastSyncPointUniqueId(NULL)
 		,_totalThreadCount(0)
 		,_threadCount(0)
 		,_workUnitIndex(0)
-		,_synchronizeIndex(0)
-		,_synchronizeCount(0)
+		,_synchronizeBarrier()
 		,_synchronizeMutex(NULL)
+		,_synchronizeSpinMaximum(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -95,6 +95,11 @@ MM_TLHAllocationInterface::initialize(MM_EnvironmentBase *env)
 void
 MM_TLHAllocationInterface::tearDown(MM_EnvironmentBase *env)
 {
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* The pre-zeroing service must not reference this interface once it is gone */
+	_tlhAllocationSupport.discardPreZeroedTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	if (NULL != _frequentObjectsStats) {
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
@@ -124,18 +129,19 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 {
 	 MM_GCExtensionsBase *extensions = env->getExtensions();
 
+	/* Reconnect the caches first, so that memory they abandon is counted in the merged stats */
+	_tlhAllocationSupport.reconnect(env, shouldFlush);
+
+#if defined(OMR_GC_NON_ZERO_TLH)
+	_tlhAllocationSupportNonZero.reconnect(env, shouldFlush);
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
 	 if(shouldFlush) {
 		extensions->allocationStats.merge(&_stats);
 		_stats.clear();
 		/* Since AllocationStats have been reset, reset the base */
 		_bytesAllocatedBase = 0;
 	}
-	
-	_tlhAllocationSupport.reconnect(env, shouldFlush);
-
-#if defined(OMR_GC_NON_ZERO_TLH)
-	_tlhAllocationSupportNonZero.reconnect(env, shouldFlush);
-#endif /* defined(OMR_GC_NON_ZERO_TLH) */
 };
 
 
@@ -290,15 +296,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
+	/* Flush the caches first, so that memory they abandon is counted in the merged stats */
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
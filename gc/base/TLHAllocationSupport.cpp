@@ -31,6 +31,7 @@
 
 #include "TLHAllocationSupport.hpp"
 
+#include "omrport.h"
 #include "ModronAssertions.h"
 #include "objectdescription.h"
 #include "omrutil.h"
@@ -38,16 +39,19 @@
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
 #include "AllocationStats.hpp"
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
+#include "IdleHeapManager.hpp"
 #include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "TLHPreZeroingService.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -91,6 +95,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 
 	/* Any previous cache to clear  ? */
 	if (NULL != memoryPool) {
+		_objectAllocationInterface->getAllocationStats()->_tlhAbandonedBytes += (uintptr_t)getTop() - (uintptr_t)getRealAlloc();
 		memoryPool->abandonTlhHeapChunk(getRealAlloc(), getTop());
 		reportClearCache(env);
 	}
@@ -109,10 +114,13 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
  MM_TLHAllocationSupport::reconnect(MM_EnvironmentBase *env, bool shouldFlush)
 {
 	 MM_GCExtensionsBase *extensions = env->getExtensions();
+	 OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	if(shouldFlush) {
-		_abandonedList = NULL;
-		_abandonedListSize = 0;
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		discardPreZeroedTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+		discardAbandonedList(env);
 		clear(env);
 	} else {
 		/* Clear current information accumulated */
@@ -120,6 +128,11 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+
+	/* Start measuring the allocation rate afresh */
+	_allocationRate = 0.0f;
+	_refreshCountSinceRestart = 0;
+	_lastRefreshTime = omrtime_hires_clock();
 };
 
 /**
@@ -142,9 +155,63 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		if (0 == _refreshCountSinceRestart) {
+			/* The thread did not refresh since the last GC: decay its rate and keep its TLH tiny */
+			_allocationRate = MM_Math::weightedAverage(_allocationRate, 0.0f, extensions->tlhAllocationRateHistoryWeight);
+			refreshSize = extensions->tlhMinimumSize;
+		}
+		_tlh->refreshSize = refreshSize;
+		_refreshCountSinceRestart = 0;
+		/* Time spent in the GC does not count against the first TLH after it */
+		_lastRefreshTime = omrtime_hires_clock();
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 };
 
+/**
+ * Fold the consumption of the TLH being retired into the smoothed allocation rate.
+ *
+ * @param consumedBytes the number of bytes allocated from the retired TLH since it was set up
+ */
+void
+MM_TLHAllocationSupport::updateAllocationRate(MM_EnvironmentBase *env, uintptr_t consumedBytes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	uint64_t now = omrtime_hires_clock();
+	/* Back to back refreshes are counted as one microsecond apart */
+	uint64_t elapsedMicros = OMR_MAX(omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+	float sampledRate = (float)consumedBytes / (float)elapsedMicros;
+
+	_allocationRate = MM_Math::weightedAverage(_allocationRate, sampledRate, extensions->tlhAllocationRateHistoryWeight);
+	_lastRefreshTime = now;
+	_refreshCountSinceRestart += 1;
+}
+
+/**
+ * Determine the refresh size that lets the thread allocate for one target refresh interval at its
+ * smoothed allocation rate, within the TLH minimum and maximum sizes.
+ *
+ * @return the refresh size in bytes
+ */
+uintptr_t
+MM_TLHAllocationSupport::getAdaptiveRefreshSize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	float desiredSize = _allocationRate * (float)extensions->tlhTargetRefreshInterval;
+	uintptr_t refreshSize = extensions->tlhMaximumSize;
+	if (desiredSize < (float)extensions->tlhMaximumSize) {
+		refreshSize = OMR_MAX((uintptr_t)desiredSize, extensions->tlhMinimumSize);
+	}
+
+	return MM_Math::roundToCeiling(extensions->getObjectAlignmentInBytes(), refreshSize);
+}
+
 /**
  * Refresh the TLH.
  */
@@ -171,6 +238,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	/* Bytes consumed from the TLH being retired, sampled by adaptive sizing */
+	uintptr_t consumedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -221,6 +291,11 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhDiscardedBytes -= getSize();
 
 		didRefresh = true;
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	} else if (usePreZeroedTLH(env, allocDescription, sizeInBytesRequired)) {
+		/* The reserve was zeroed in the background, nothing left to clear */
+		didRefresh = true;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	} else {
 		/* Try allocating a fresh TLH */
 		MM_AllocationContext *ac = env->getAllocationContext();
@@ -238,11 +313,25 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 		if (didRefresh) {
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
+			void *zeroTop = getTop();
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+			MM_IdleHeapManager *idleHeapManager = extensions->idleHeapManager;
+			if ((NULL != idleHeapManager) && idleHeapManager->hasKnownZeroMemory()) {
+				/* Pages released while idle may still read as zero */
+				zeroTop = idleHeapManager->claimKnownZeroMemory(env, getBase(), getTop());
+			}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 			if (_zeroTLH) {
 				if (0 != extensions->batchClearTLH) {
 					void *base = getBase();
-					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					uintptr_t size = (uintptr_t)zeroTop - (uintptr_t)base;
+					uintptr_t nonTemporalThreshold = extensions->batchClearTLHNonTemporalThreshold;
+					if ((0 != nonTemporalThreshold) && (size >= nonTemporalThreshold)) {
+						/* Most of a large TLH is not touched again soon: do not flush the cache for it */
+						OMRZeroMemoryNonTemporal(base, size);
+					} else {
+						OMRZeroMemory(base, size);
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -274,11 +363,19 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
-			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (extensions->tlhAdaptiveSizing) {
+				/* Size the next TLH to last about one target refresh interval */
+				updateAllocationRate(env, consumedBytes);
+				setRefreshSize(getAdaptiveRefreshSize(env));
+			} else if (getRefreshSize() < tlhMaximumSize) {
+				/* Increase thread hungriness */
+				/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+			/* Have the next TLH zeroed in the background while this one is in use */
+			reservePreZeroedTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		}
 	}
 
@@ -345,12 +442,142 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
-	/* Since AllocationStats have been reset, reset the base as well*/
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	discardPreZeroedTLH(env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+	discardAbandonedList(env);
+	clear(env);
+}
+
+/**
+ * Drop the cached TLHs on the abandoned list. Their memory is left to the next GC and counted as abandoned.
+ */
+void
+MM_TLHAllocationSupport::discardAbandonedList(MM_EnvironmentBase *env)
+{
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+
+	for (MM_HeapLinkedFreeHeaderTLH *cache = _abandonedList; NULL != cache; cache = (MM_HeapLinkedFreeHeaderTLH *)cache->getNext()) {
+		stats->_tlhAbandonedBytes += cache->getSize();
+	}
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
-	clear(env);
 }
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+/**
+ * Reserve the next TLH, of the current refresh size, from the pool of the current TLH and queue it for
+ * zeroing by the pre-zeroing service.  Nothing is reserved if a reserve is already outstanding, if the
+ * service is not running, or if the pool cannot satisfy the request without collecting.
+ */
+void
+MM_TLHAllocationSupport::reservePreZeroedTLH(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_TLHPreZeroingService *service = extensions->tlhPreZeroingService;
+	MM_MemoryPool *memoryPool = getMemoryPool();
+
+	if (_zeroTLH && (0 != extensions->batchClearTLH) && (NULL != service) && (NULL == _preZeroedTLH)
+		&& (NULL != memoryPool) && (NULL == env->getAllocationContext())
+	) {
+		MM_AllocateDescription reserveDescription(0, 0, false, true);
+		void *addrBase = NULL;
+		void *addrTop = NULL;
+		if (NULL != memoryPool->allocateTLH(env, &reserveDescription, getRefreshSize(), addrBase, addrTop)) {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+			MM_IdleHeapManager *idleHeapManager = extensions->idleHeapManager;
+			if ((NULL != idleHeapManager) && idleHeapManager->hasKnownZeroMemory()) {
+				/* The reserve is zeroed in full anyway, but takes its range out of the known zero memory */
+				idleHeapManager->claimKnownZeroMemory(env, addrBase, addrTop);
+			}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+			uintptr_t reserveSize = (uintptr_t)addrTop - (uintptr_t)addrBase;
+			if (reserveSize < extensions->tlhMinimumSize) {
+				/* Too small to be worth zeroing ahead of time */
+				memoryPool->abandonTlhHeapChunk(addrBase, addrTop);
+				_objectAllocationInterface->getAllocationStats()->_tlhAbandonedBytes += reserveSize;
+			} else {
+				/* Shaped like an abandoned TLH so that the heap stays walkable */
+				MM_HeapLinkedFreeHeaderTLH *reserve = (MM_HeapLinkedFreeHeaderTLH *)addrBase;
+#if defined(OMR_VALGRIND_MEMCHECK)
+				valgrindMakeMemUndefined((uintptr_t)reserve, sizeof(MM_HeapLinkedFreeHeaderTLH));
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+				reserve->setSize(reserveSize);
+				reserve->setNext(NULL);
+				reserve->_memoryPool = memoryPool;
+				reserve->_memorySubSpace = getMemorySubSpace();
+				_preZeroedTLH = reserve;
+				_preZeroedTLHReady = false;
+				service->enqueue(env, this);
+			}
+		}
+	}
+}
+
+/**
+ * Set up the reserved TLH as the current one if the pre-zeroing service has finished zeroing it.
+ *
+ * @return true if the TLH was refreshed from the reserve, false if there is no reserve ready for the request
+ */
+bool
+MM_TLHAllocationSupport::usePreZeroedTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeInBytesRequired)
+{
+	MM_HeapLinkedFreeHeaderTLH *reserve = _preZeroedTLH;
+
+	if ((NULL == reserve) || !_preZeroedTLHReady || (sizeInBytesRequired > reserve->getSize())) {
+		return false;
+	}
+	/* Pairs with the store barrier the service issues before setting the flag */
+	MM_AtomicOperations::loadSync();
+
+	_preZeroedTLH = NULL;
+	_preZeroedTLHReady = false;
+	setupTLH(env, (void *)reserve, (void *)reserve->afterEnd(), reserve->_memorySubSpace, reserve->_memoryPool);
+	/* Only the header written when the reserve was taken is left to clear */
+	memset(getBase(), 0, sizeof(MM_HeapLinkedFreeHeaderTLH));
+
+	if (env->getExtensions()->fvtest_verifyPreZeroedTLH) {
+		for (uintptr_t *slot = (uintptr_t *)getBase(); slot < (uintptr_t *)getTop(); slot++) {
+			Assert_MM_true(0 == *slot);
+		}
+	}
+
+	allocDescription->setTLHAllocation(true);
+	allocDescription->setNurseryAllocation(getMemorySubSpace()->getTypeFlags() == MEMORY_TYPE_NEW);
+	allocDescription->setMemoryPool(getMemoryPool());
+#if defined(OMR_GC_ALLOCATION_TAX)
+	if (env->getExtensions()->payAllocationTax) {
+		allocDescription->setAllocationTaxSize(getSize());
+	}
+#endif /* OMR_GC_ALLOCATION_TAX */
+
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	stats->_tlhRefreshCountFresh += 1;
+	stats->_tlhRefreshCountPreZeroed += 1;
+	stats->_tlhAllocatedFresh += getSize();
+
+	return true;
+}
+
+/**
+ * Take the reserved TLH back from the pre-zeroing service and drop it.  Like the abandoned list, its
+ * memory is left to the next GC and counted as abandoned.
+ */
+void
+MM_TLHAllocationSupport::discardPreZeroedTLH(MM_EnvironmentBase *env)
+{
+	if (NULL != _preZeroedTLH) {
+		MM_TLHPreZeroingService *service = env->getExtensions()->tlhPreZeroingService;
+		if (NULL != service) {
+			service->withdraw(env, this);
+		}
+		_objectAllocationInterface->getAllocationStats()->_tlhAbandonedBytes += _preZeroedTLH->getSize();
+		_preZeroedTLH = NULL;
+		_preZeroedTLHReady = false;
+	}
+}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 void
 MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
 {
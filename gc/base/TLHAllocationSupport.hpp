@@ -81,6 +81,16 @@ private:
 	MM_HeapLinkedFreeHeaderTLH *_abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
 
+	uint64_t _lastRefreshTime; /**< Hi-res clock at the last TLH refresh or GC restart (adaptive sizing only) */
+	float _allocationRate; /**< Smoothed TLH allocation rate in bytes per microsecond (adaptive sizing only) */
+	uintptr_t _refreshCountSinceRestart; /**< TLH refreshes since the last GC restart; none means the thread was idle (adaptive sizing only) */
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	MM_HeapLinkedFreeHeaderTLH *_preZeroedTLH; /**< The next TLH, reserved and queued for zeroing by the pre-zeroing service, NULL if none. */
+	volatile bool _preZeroedTLHReady; /**< Set by the pre-zeroing service once _preZeroedTLH is zeroed past its header. */
+	MM_TLHAllocationSupport *_preZeroingNext; /**< Link in the pre-zeroing service queue, owned by the service. */
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 public:
@@ -89,6 +99,16 @@ private:
 	void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
 	void flushCache(MM_EnvironmentBase *env);
+	void discardAbandonedList(MM_EnvironmentBase *env);
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	void reservePreZeroedTLH(MM_EnvironmentBase *env);
+	bool usePreZeroedTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeInBytesRequired);
+	void discardPreZeroedTLH(MM_EnvironmentBase *env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+	void updateAllocationRate(MM_EnvironmentBase *env, uintptr_t consumedBytes);
+	uintptr_t getAdaptiveRefreshSize(MM_EnvironmentBase *env);
 
 	MMINLINE void *getBase() { return (void *)_tlh->heapBase; };
 	MMINLINE void setBase(void *basePtr) { _tlh->heapBase = (uint8_t *)basePtr; };
@@ -185,6 +205,14 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
+		_lastRefreshTime(0),
+		_allocationRate(0.0f),
+		_refreshCountSinceRestart(0),
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		_preZeroedTLH(NULL),
+		_preZeroedTLHReady(false),
+		_preZeroingNext(NULL),
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		_zeroTLH(zeroTLH)
 	{};
 
@@ -192,6 +220,9 @@ private:
 	 * friends
 	 */
 	friend class MM_TLHAllocationInterface;
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	friend class MM_TLHPreZeroingService;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 };
 
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrutil.h"
+
+#include "TLHPreZeroingService.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "TLHAllocationSupport.hpp"
+
+MM_TLHPreZeroingService::MM_TLHPreZeroingService(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _omrVM(env->getOmrVM())
+	, _serviceMonitor(NULL)
+	, _serviceState(SERVICE_STATE_ERROR)
+	, _queueHead(NULL)
+	, _queueTail(NULL)
+	, _inProgress(NULL)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_TLHPreZeroingService *
+MM_TLHPreZeroingService::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TLHPreZeroingService *service = (MM_TLHPreZeroingService *)env->getForge()->allocate(sizeof(MM_TLHPreZeroingService), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != service) {
+		new(service) MM_TLHPreZeroingService(env);
+		if (!service->initialize(env)) {
+			service->kill(env);
+			service = NULL;
+		}
+	}
+	return service;
+}
+
+void
+MM_TLHPreZeroingService::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TLHPreZeroingService::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_serviceMonitor, 0, "MM_TLHPreZeroingService::_serviceMonitor")) {
+		return false;
+	}
+
+	return startServiceThread(env);
+}
+
+void
+MM_TLHPreZeroingService::tearDown(MM_EnvironmentBase *env)
+{
+	stopServiceThread(env);
+
+	if (NULL != _serviceMonitor) {
+		omrthread_monitor_destroy(_serviceMonitor);
+		_serviceMonitor = NULL;
+	}
+}
+
+void
+MM_TLHPreZeroingService::enqueue(MM_EnvironmentBase *env, MM_TLHAllocationSupport *support)
+{
+	omrthread_monitor_enter(_serviceMonitor);
+	if (SERVICE_STATE_RUNNING == _serviceState) {
+		support->_preZeroingNext = NULL;
+		if (NULL == _queueTail) {
+			_queueHead = support;
+		} else {
+			_queueTail->_preZeroingNext = support;
+		}
+		_queueTail = support;
+		omrthread_monitor_notify(_serviceMonitor);
+	}
+	omrthread_monitor_exit(_serviceMonitor);
+}
+
+void
+MM_TLHPreZeroingService::withdraw(MM_EnvironmentBase *env, MM_TLHAllocationSupport *support)
+{
+	omrthread_monitor_enter(_serviceMonitor);
+	while (support == _inProgress) {
+		omrthread_monitor_wait(_serviceMonitor);
+	}
+
+	/* The queue holds one entry per allocating thread at most, so a linear search is fine */
+	MM_TLHAllocationSupport *previous = NULL;
+	MM_TLHAllocationSupport *current = _queueHead;
+	while ((NULL != current) && (support != current)) {
+		previous = current;
+		current = current->_preZeroingNext;
+	}
+	if (NULL != current) {
+		if (NULL == previous) {
+			_queueHead = current->_preZeroingNext;
+		} else {
+			previous->_preZeroingNext = current->_preZeroingNext;
+		}
+		if (_queueTail == current) {
+			_queueTail = previous;
+		}
+		current->_preZeroingNext = NULL;
+	}
+	omrthread_monitor_exit(_serviceMonitor);
+}
+
+int J9THREAD_PROC
+MM_TLHPreZeroingService::serviceThreadProc(void *info)
+{
+	MM_TLHPreZeroingService *service = (MM_TLHPreZeroingService *)info;
+	service->serviceEntryPoint();
+	return 0;
+}
+
+void
+MM_TLHPreZeroingService::serviceEntryPoint()
+{
+	omrthread_monitor_enter(_serviceMonitor);
+	_serviceState = SERVICE_STATE_RUNNING;
+	omrthread_monitor_notify_all(_serviceMonitor);
+
+	while (SERVICE_STATE_TERMINATION_REQUESTED != _serviceState) {
+		if (NULL == _queueHead) {
+			omrthread_monitor_wait(_serviceMonitor);
+			continue;
+		}
+
+		MM_TLHAllocationSupport *support = _queueHead;
+		_queueHead = support->_preZeroingNext;
+		if (NULL == _queueHead) {
+			_queueTail = NULL;
+		}
+		support->_preZeroingNext = NULL;
+		_inProgress = support;
+		MM_HeapLinkedFreeHeaderTLH *reserve = support->_preZeroedTLH;
+		omrthread_monitor_exit(_serviceMonitor);
+
+		/* The free header is left intact so that the heap stays walkable while the reserve waits to be used */
+		OMRZeroMemoryNonTemporal((void *)(reserve + 1), reserve->getSize() - sizeof(MM_HeapLinkedFreeHeaderTLH));
+
+		omrthread_monitor_enter(_serviceMonitor);
+		/* The owner checks the flag without the monitor: the zeroes must be visible first */
+		MM_AtomicOperations::storeSync();
+		support->_preZeroedTLHReady = true;
+		_inProgress = NULL;
+		omrthread_monitor_notify_all(_serviceMonitor);
+	}
+
+	/* Reserves still queued are never zeroed: their owners drop them when their caches are next flushed */
+	while (NULL != _queueHead) {
+		MM_TLHAllocationSupport *support = _queueHead;
+		_queueHead = support->_preZeroingNext;
+		support->_preZeroingNext = NULL;
+	}
+	_queueTail = NULL;
+
+	_serviceState = SERVICE_STATE_TERMINATED;
+	omrthread_monitor_notify_all(_serviceMonitor);
+	omrthread_exit(_serviceMonitor);
+}
+
+bool
+MM_TLHPreZeroingService::startServiceThread(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that we cannot miss its start-up notification */
+	omrthread_monitor_enter(_serviceMonitor);
+	_serviceState = SERVICE_STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		serviceThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (SERVICE_STATE_STARTING == _serviceState) {
+			omrthread_monitor_wait(_serviceMonitor);
+		}
+		success = (SERVICE_STATE_RUNNING == _serviceState);
+	} else {
+		_serviceState = SERVICE_STATE_ERROR;
+	}
+	omrthread_monitor_exit(_serviceMonitor);
+
+	return success;
+}
+
+void
+MM_TLHPreZeroingService::stopServiceThread(MM_EnvironmentBase *env)
+{
+	if (NULL == _serviceMonitor) {
+		return;
+	}
+
+	omrthread_monitor_enter(_serviceMonitor);
+	if (SERVICE_STATE_RUNNING == _serviceState) {
+		_serviceState = SERVICE_STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_serviceMonitor);
+		while (SERVICE_STATE_TERMINATED != _serviceState) {
+			omrthread_monitor_wait(_serviceMonitor);
+		}
+	}
+	omrthread_monitor_exit(_serviceMonitor);
+}
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(TLHPREZEROINGSERVICE_HPP_)
+#define TLHPREZEROINGSERVICE_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "BaseNonVirtual.hpp"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+class MM_EnvironmentBase;
+class MM_TLHAllocationSupport;
+
+/**
+ * Low priority background thread that zeroes TLHs before they are needed.
+ *
+ * With batch clearing, a TLH is zeroed on the allocation slow path as it is handed out.  With
+ * tlhPreZeroing set, every refresh of a batch cleared TLH also reserves the thread's next TLH and
+ * queues it here.  This thread zeroes the reserve with streaming stores, so that the next refresh
+ * can hand it out without zeroing anything.  A refresh does not wait for a reserve that is not
+ * zeroed yet.  Reserves are withdrawn when allocation caches are flushed, so this thread never
+ * touches the heap while a GC is running.
+ */
+class MM_TLHPreZeroingService : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum {
+		SERVICE_STATE_ERROR = 0,
+		SERVICE_STATE_STARTING,
+		SERVICE_STATE_RUNNING,
+		SERVICE_STATE_TERMINATION_REQUESTED,
+		SERVICE_STATE_TERMINATED
+	} ServiceState;
+
+	OMR_VM *_omrVM;
+	omrthread_monitor_t _serviceMonitor; /**< protects the queue and _serviceState; the service thread waits on it for work */
+	volatile ServiceState _serviceState;
+
+	MM_TLHAllocationSupport *_queueHead; /**< reserves waiting to be zeroed, linked through their owner's _preZeroingNext */
+	MM_TLHAllocationSupport *_queueTail;
+	MM_TLHAllocationSupport *_inProgress; /**< owner of the reserve being zeroed outside the monitor, NULL if none */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_TLHPreZeroingService *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue the reserve TLH of the given cache for zeroing.  Ignored once the service thread is stopping.
+	 */
+	void enqueue(MM_EnvironmentBase *env, MM_TLHAllocationSupport *support);
+
+	/**
+	 * Take the reserve TLH of the given cache back from the service, waiting if it is being zeroed.
+	 * On return the service thread no longer references the cache or its reserve.
+	 */
+	void withdraw(MM_EnvironmentBase *env, MM_TLHAllocationSupport *support);
+
+	static int J9THREAD_PROC serviceThreadProc(void *info);
+
+	MM_TLHPreZeroingService(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	bool startServiceThread(MM_EnvironmentBase *env);
+	void stopServiceThread(MM_EnvironmentBase *env);
+	void serviceEntryPoint();
+};
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+#endif /* TLHPREZEROINGSERVICE_HPP_ */
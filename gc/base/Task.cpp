@@ -31,6 +31,12 @@
 void
 MM_Task::accept(MM_EnvironmentBase *env)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_TaskPhaseStats *phaseStats = &env->_taskPhaseStats;
+	phaseStats->clear();
+	phaseStats->_startTime = omrtime_hires_clock();
+	phaseStats->_dispatchTime = phaseStats->_startTime - _dispatchStartTime;
+
 	/* store the old VMstate */
 	uintptr_t oldVMstate = env->pushVMstate(getVMStateID());
 	if (env->isMasterThread()) {
@@ -78,6 +84,12 @@ MM_Task::complete(MM_EnvironmentBase *env)
 	
 	/* do task-specific cleanup */
 	cleanup(env);
+
+	/* callers of complete() hold the synchronize mutex while more than one thread is running the task */
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_TaskPhaseStats *phaseStats = &env->_taskPhaseStats;
+	phaseStats->_totalTime = omrtime_hires_clock() - phaseStats->_startTime;
+	_phaseStats.merge(phaseStats);
 }
 
 bool 
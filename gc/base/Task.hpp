@@ -35,6 +35,7 @@
 #include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "Debug.hpp"
+#include "TaskPhaseStats.hpp"
 
 /* Macro to create an unique literal string identifier */ 
 #define UNIQUE_ID ((const char *)(OMR_GET_CALLSITE()))
@@ -53,6 +54,9 @@ protected:
 	MM_Dispatcher *_dispatcher;
 
 	uintptr_t _oldVMstate; /**< the vmState at the start of the task */
+
+	uint64_t _dispatchStartTime; /**< hi-res time at which the task was handed to the dispatcher */
+	MM_TaskPhaseStats _phaseStats; /**< per thread phase timings merged as each thread completes the task */
 	
 public:
 	virtual void setup(MM_EnvironmentBase *env);
@@ -81,6 +85,11 @@ public:
 		/* in a Task we don't need a mutex */
 	}
 
+	MMINLINE virtual void setSynchronizeSpinMaximum(uintptr_t spinMaximum)
+	{
+		/* in a Task threads never wait for each other */
+	}
+
 	virtual void accept(MM_EnvironmentBase *env);
 	virtual void complete(MM_EnvironmentBase *env);
 
@@ -151,13 +160,22 @@ public:
 	 */
 	virtual bool shouldYieldFromTask(MM_EnvironmentBase *env) { return false; }
 
+	/**
+	 * Phase timings of all threads which have completed the task so far.  Only complete once the dispatcher
+	 * has returned from completing the task on the master thread.
+	 * @return the merged phase timings
+	 */
+	MMINLINE MM_TaskPhaseStats *getPhaseStats() { return &_phaseStats; }
+
 	/**
 	 * Create a Task object.
 	 */
 	MM_Task(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher) :
 		MM_BaseVirtual(),
 		_dispatcher(dispatcher),
-		_oldVMstate(0)
+		_oldVMstate(0),
+		_dispatchStartTime(0),
+		_phaseStats()
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -472,6 +472,7 @@ MM_WorkPackets::getInputPacket(MM_EnvironmentBase *env)
 					} else {
 						env->_workPacketStats.addToWorkStallTime(waitStartTime, waitEndTime);
 					}
+					env->_taskPhaseStats.addToIdleTime(waitStartTime, waitEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 #if defined(OMR_GC_VLHGC)
@@ -37,6 +37,7 @@
 #include "ModronAssertions.h"
 #include "omr.h"
 
+#include <math.h>
 #include <string.h>
 
 #include "AllocateDescription.hpp"
@@ -376,7 +377,10 @@ MM_ConcurrentGC::reportConcurrentCollectionStart(MM_EnvironmentBase *env)
 			_stats.getConcurrentWorkStackOverflowCount(),
 			_stats.getThreadsToScanCount(),
 			_stats.getThreadsScannedCount(),
-			_stats.getCardCleaningReason()
+			_stats.getCardCleaningReason(),
+			_stats.getAssistPaymentCount(),
+			_stats.getAssistDeferredCount(),
+			_stats.getAssistInstallmentCount()
 		);
 	}
 }
@@ -654,6 +658,15 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 													MAX_ALLOC_2_TRACE_RATE_10,
 													_allocToTraceRateNormal);
 
+	if (_extensions->concurrentKickoffForecast) {
+		/* One-sided Chebyshev (Cantelli) bound: the allocation rate exceeds mean + k * stddev with
+		 * probability at most 1 / (1 + k^2), so k = sqrt(p / (1 - p)) for a desired confidence p.
+		 * This holds whatever the distribution of the rate, which suits bursty allocators.
+		 */
+		float confidence = OMR_MAX((float)0, OMR_MIN(_extensions->concurrentKickoffForecastConfidence, MAX_KICKOFF_FORECAST_CONFIDENCE));
+		_forecastConfidenceFactor = (float)sqrt(confidence / ((float)1 - confidence));
+	}
+
 	if (_extensions->debugConcurrentMark) {
 		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 		omrtty_printf("Initial tuning statistics: Card Cleaning Factors Pass1=\"%.3f\" Pass2=\"%.3f\" (Maximum: Pass1=\"%.3f\" Pass2=\"%.3f\")\n",
@@ -1468,6 +1481,10 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 							_stats.getCardCleaningThreshold());
 		omrtty_printf("               Init Work Required=\"%zu\" \n",
 							_stats.getInitWorkRequired());
+		if (_extensions->concurrentKickoffForecast) {
+			omrtty_printf("               Forecast Alloc Rate=\"%.3f\" (Stddev=\"%.3f\") Mark Rate=\"%.3f\" bytes/us\n",
+								_forecastAllocRate, (float)sqrt(_forecastAllocRateVariance), _forecastMarkRate);
+		}
 	}
 
 	_initSetupDone = false;
@@ -1486,6 +1503,9 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
     _lastFreeSize = LAST_FREE_SIZE_NEEDS_INITIALIZING;
 	_lastTotalTraced = 0;
 
+	/* Free space has been replenished so the next sample starts a new interval; the smoothed rates are kept */
+	_forecastLastSampleFree = LAST_FREE_SIZE_NEEDS_INITIALIZING;
+
 	Trc_MM_ConcurrentGC_tuneToHeap_Exit2(env->getLanguageVMThread(), _stats.getTraceSizeTarget(), _stats.getInitWorkRequired(), _stats.getKickoffThreshold());
 }
 
@@ -1780,6 +1800,88 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	return sizeToTrace;
 }
 
+/**
+ * Calculate the paced allocation tax.
+ * The tax due for this allocation is added to the debt of the mutator. A mutator whose debt is still
+ * small while the background helper threads are marking leaves the work to them; otherwise it pays
+ * as much of its debt as it can trace within the latency limit. The limit is relaxed only once the
+ * debt grows beyond MUTATOR_ASSIST_DEBT_LIMIT_FACTOR payments, so a mutator can never fall far behind.
+ *
+ * @param taxDue the tax calculated for the current allocation
+ * @return the amount of tracing the mutator should do now
+ */
+uintptr_t
+MM_ConcurrentGC::calculateAssistPayment(MM_EnvironmentBase *env, uintptr_t taxDue)
+{
+	/* Debt incurred during an earlier cycle has been settled by the collection that ended it */
+	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
+	if (env->_concurrentAssistDebtGCCount != gcCount) {
+		env->_concurrentAssistDebt = 0;
+		env->_concurrentAssistDebtGCCount = gcCount;
+	}
+
+	uintptr_t debt = env->_concurrentAssistDebt + OMR_MIN(taxDue, UDATA_MAX - env->_concurrentAssistDebt);
+	env->_concurrentAssistDebt = debt;
+
+	/* Let background helper threads absorb the work first */
+	uintptr_t minimumPayment = _extensions->concurrentAssistMinimumPayment;
+	if ((debt < minimumPayment) && (0 < _conHelpersStarted) && (CONCURRENT_HELPER_MARK == _conHelpersRequest)) {
+		_stats.incAssistDeferredCount();
+		return 0;
+	}
+
+	uintptr_t payment = debt;
+	if (0 < _mutatorAssistMarkRate) {
+		uintptr_t latencyLimit = OMR_MAX((uintptr_t)(_mutatorAssistMarkRate * (float)_extensions->concurrentAssistMaxLatency), minimumPayment);
+		uintptr_t debtLimit = latencyLimit * MUTATOR_ASSIST_DEBT_LIMIT_FACTOR;
+		if (debt <= debtLimit) {
+			payment = OMR_MIN(debt, latencyLimit);
+		} else {
+			/* Soft limit exceeded; pay enough to bring the debt back within bounds */
+			payment = OMR_MAX(debt - debtLimit, latencyLimit);
+		}
+	}
+
+	payment = OMR_MIN(payment, (uintptr_t)_maxTraceSize);
+	if (0 < payment) {
+		_stats.incAssistPaymentCount();
+		if (payment < debt) {
+			_stats.incAssistInstallmentCount();
+		}
+	}
+
+	return payment;
+}
+
+/**
+ * Settle the debt of a mutator after it traced on behalf of an allocation and update the
+ * measured rate at which mutators trace.
+ *
+ * @param payment the amount of tracing that was requested
+ * @param paid the amount of tracing actually done
+ * @param elapsedMicros the time spent tracing
+ */
+void
+MM_ConcurrentGC::settleAssistDebt(MM_EnvironmentBase *env, uintptr_t payment, uintptr_t paid, uint64_t elapsedMicros)
+{
+	if ((paid < payment) && !env->isExclusiveAccessRequestWaiting()) {
+		/* We ran out of work to do, helpers or other mutators are ahead of us so the rest of the debt is forgiven */
+		env->_concurrentAssistDebt = 0;
+	} else {
+		env->_concurrentAssistDebt -= OMR_MIN(paid, env->_concurrentAssistDebt);
+	}
+
+	if ((0 < paid) && (0 < elapsedMicros)) {
+		float rate = (float)paid / (float)elapsedMicros;
+		/* Racy update by design; losing a sample only delays convergence */
+		if (0 == _mutatorAssistMarkRate) {
+			_mutatorAssistMarkRate = rate;
+		} else {
+			_mutatorAssistMarkRate = MM_Math::weightedAverage(_mutatorAssistMarkRate, rate, MUTATOR_ASSIST_RATE_HISTORY_WEIGHT);
+		}
+	}
+}
+
 /**
  * Determine if its time to do periodical tuning.
  * Has the free space reduced by the _tuningUpdateInterval from the last time
@@ -2092,7 +2194,15 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 		case CONCURRENT_TRACE_ONLY:
 		case CONCURRENT_CLEAN_TRACE:
 			sizeToTrace = calculateTraceSize(env, allocDescription);
-			if (sizeToTrace > 0) {
+			if (_extensions->concurrentAssistPacing) {
+				sizeToTrace = calculateAssistPayment(env, sizeToTrace);
+				if (sizeToTrace > 0) {
+					OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+					uint64_t startTime = omrtime_hires_clock();
+					sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
+					settleAssistDebt(env, sizeToTrace, sizeTraced, omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+				}
+			} else if (sizeToTrace > 0) {
 				sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
 			}
 
@@ -2286,7 +2396,14 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		return false;
 	}
 
-	if ((remainingFree < _stats.getKickoffThreshold()) || _forcedKickoff) {
+	bool thresholdReached = (remainingFree < _stats.getKickoffThreshold());
+	bool forecastReached = false;
+	if (_extensions->concurrentKickoffForecast) {
+		sampleAllocationRate(env, remainingFree);
+		forecastReached = !thresholdReached && forecastExhaustionBeforeMarkComplete(env, remainingFree);
+	}
+
+	if (thresholdReached || forecastReached || _forcedKickoff) {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		/* Finish off any sweep work that was still in progress */
 		completeConcurrentSweepForKickoff(env);
@@ -2299,9 +2416,11 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 			}
 #endif /* defined(OMR_GC_REALTIME) */
 
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			_kickoffTime = omrtime_hires_clock();
 			_stats.setRemainingFree(remainingFree);
 			/* Set kickoff reason if it is not set yet */
-			_stats.setKickoffReason(KICKOFF_THRESHOLD_REACHED);
+			_stats.setKickoffReason(forecastReached ? ALLOCATION_RATE_FORECAST : KICKOFF_THRESHOLD_REACHED);
 			_languageKickoffReason = NO_LANGUAGE_KICKOFF_REASON;
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			_extensions->setConcurrentGlobalGCInProgress(true);
@@ -2314,6 +2433,104 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 	}
 }
 
+void
+MM_ConcurrentGC::sampleAllocationRate(MM_EnvironmentBase *env, uintptr_t remainingFree)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t now = omrtime_hires_clock();
+	uint64_t elapsedMicros = omrtime_hires_delta(_forecastLastSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	/* Cheap unsynchronized check first; most allocations fall within the current sample interval */
+	if ((LAST_FREE_SIZE_NEEDS_INITIALIZING != _forecastLastSampleFree) && (elapsedMicros < (_extensions->concurrentKickoffForecastSampleInterval * 1000))) {
+		return;
+	}
+
+	/* Only one thread takes a sample; any other thread arriving now simply skips it */
+	if (0 != omrthread_monitor_try_enter(_concurrentTuningMonitor)) {
+		return;
+	}
+
+	if (LAST_FREE_SIZE_NEEDS_INITIALIZING == _forecastLastSampleFree) {
+		_forecastLastSampleTime = now;
+		_forecastLastSampleFree = remainingFree;
+	} else {
+		elapsedMicros = omrtime_hires_delta(_forecastLastSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (elapsedMicros >= (_extensions->concurrentKickoffForecastSampleInterval * 1000)) {
+			/* Free space may have grown (heap expansion, concurrent sweep); that interval tells us nothing about the rate */
+			if (_forecastLastSampleFree > remainingFree) {
+				float sample = (float)(_forecastLastSampleFree - remainingFree) / (float)elapsedMicros;
+				if (0 == _forecastSampleCount) {
+					_forecastAllocRate = sample;
+					_forecastAllocRateVariance = 0;
+				} else {
+					/* Exponentially weighted mean and variance of the allocation rate */
+					float delta = sample - _forecastAllocRate;
+					float increment = ((float)1 - ALLOCATION_RATE_HISTORY_WEIGHT) * delta;
+					_forecastAllocRate += increment;
+					_forecastAllocRateVariance = ALLOCATION_RATE_HISTORY_WEIGHT * (_forecastAllocRateVariance + (delta * increment));
+				}
+				_forecastSampleCount += 1;
+			}
+			_forecastLastSampleTime = now;
+			_forecastLastSampleFree = remainingFree;
+		}
+	}
+
+	omrthread_monitor_exit(_concurrentTuningMonitor);
+}
+
+bool
+MM_ConcurrentGC::forecastExhaustionBeforeMarkComplete(MM_EnvironmentBase *env, uintptr_t remainingFree)
+{
+	/* Until we have measured both rates fall back to the kickoff threshold alone */
+	if ((ALLOCATION_RATE_FORECAST_MIN_SAMPLES > _forecastSampleCount) || (0 == _forecastMarkRate)) {
+		return false;
+	}
+
+	float allocRateBound = _forecastAllocRate + (_forecastConfidenceFactor * (float)sqrt(_forecastAllocRateVariance));
+	if (0 >= allocRateBound) {
+		return false;
+	}
+
+	/* Marking must finish the init work and the trace target before the (pessimistic) allocator exhausts
+	 * the free space left above the kickoff buffer, mirroring the buffer used by calculateTraceSize().
+	 */
+	float usableFree = (float)MM_Math::saturatingSubtract(remainingFree, _kickoffThresholdBuffer);
+	float microsToExhaustion = usableFree / allocRateBound;
+	float microsToCompleteMark = (float)(_stats.getTraceSizeTarget() + _stats.getInitWorkRequired()) / _forecastMarkRate;
+
+	return microsToExhaustion <= microsToCompleteMark;
+}
+
+void
+MM_ConcurrentGC::updateForecastMarkRate(MM_EnvironmentBase *env, uintptr_t executionModeAtGC)
+{
+	if (!_extensions->concurrentKickoffForecast || (CONCURRENT_OFF == executionModeAtGC)) {
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t elapsedMicros = omrtime_hires_delta(_kickoffTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uintptr_t workDone = _stats.getTotalTraced();
+
+	/* Init work is charged at a boosted rate but counted in bytes as well */
+	if (CONCURRENT_INIT_COMPLETE <= executionModeAtGC) {
+		workDone += _stats.getInitWorkRequired();
+	}
+
+	if ((0 < elapsedMicros) && (0 < workDone)) {
+		float markRate = (float)workDone / (float)elapsedMicros;
+		if (0 == _forecastMarkRate) {
+			_forecastMarkRate = markRate;
+		} else if ((CONCURRENT_EXHAUSTED > executionModeAtGC) && (markRate < _forecastMarkRate)) {
+			/* The cycle did not finish tracing in time, so the rate we predicted was too optimistic; adopt the observed rate outright */
+			_forecastMarkRate = markRate;
+		} else {
+			_forecastMarkRate = MM_Math::weightedAverage(_forecastMarkRate, markRate, CONCURRENT_MARK_RATE_HISTORY_WEIGHT);
+		}
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 /**
  * Run a concurrent sweep as part of the current allocation tax.
@@ -2924,6 +3141,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 	/* Remember the executionMode at the point when the GC was triggered */
 	uintptr_t executionModeAtGC = _stats.getExecutionMode();
 	_stats.setExecutionModeAtGC(executionModeAtGC);
+
+	/* A system GC cuts the cycle short, so its duration says nothing about the marking rate */
+	if (!MM_GCCode(gcCode).isExplicitGC()) {
+		updateForecastMarkRate(env, executionModeAtGC);
+	}
 	
 	Assert_MM_true(NULL == env->_cycleState);
 
@@ -121,6 +121,22 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define LAST_FREE_SIZE_NEEDS_INITIALIZING ((uintptr_t)-1)
 #define ALL_BYTES_TRACED_IN_PASS_1 ((float)1.0)
 
+/**
+ * @}
+ */
+
+/**
+ * @name Concurrent kickoff forecasting
+ * @{
+ */
+#define ALLOCATION_RATE_HISTORY_WEIGHT ((float)0.75)
+#define CONCURRENT_MARK_RATE_HISTORY_WEIGHT ((float)0.5)
+#define ALLOCATION_RATE_FORECAST_MIN_SAMPLES 4
+#define MAX_KICKOFF_FORECAST_CONFIDENCE ((float)0.999)
+
+#define MUTATOR_ASSIST_RATE_HISTORY_WEIGHT ((float)0.8)
+#define MUTATOR_ASSIST_DEBT_LIMIT_FACTOR 4
+
 /**
  * @}
  */
@@ -249,6 +265,19 @@ private:
 	float _maxCardCleaningFactorPass2;
 	float _cardCleaningThresholdFactor;
 
+	/* Kickoff forecasting statistics */
+	uint64_t _forecastLastSampleTime; /**< hires clock value at the last allocation rate sample */
+	uintptr_t _forecastLastSampleFree; /**< taxable free space observed at the last allocation rate sample */
+	uintptr_t _forecastSampleCount; /**< number of allocation rate samples taken so far */
+	float _forecastAllocRate; /**< smoothed allocation rate, in bytes per microsecond */
+	float _forecastAllocRateVariance; /**< smoothed variance of the allocation rate */
+	float _forecastMarkRate; /**< smoothed concurrent marking rate, in bytes per microsecond (0 if not measured yet) */
+	float _forecastConfidenceFactor; /**< number of standard deviations added to the allocation rate to honour concurrentKickoffForecastConfidence */
+	uint64_t _kickoffTime; /**< hires clock value when the current concurrent cycle was kicked off */
+
+	/* Mutator assist pacing statistics */
+	float _mutatorAssistMarkRate; /**< smoothed rate, in bytes per microsecond, at which mutators pay their tax (0 if not measured yet) */
+
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
 	uintptr_t _languageKickoffReason;
@@ -313,6 +342,45 @@ private:
 	void shutdownConHelperThreads(MM_GCExtensionsBase *extensions);
 	bool timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
+	/**
+	 * Record a sample of the taxable free space and fold the allocation rate observed since the
+	 * previous sample into the smoothed rate and variance.
+	 * @param remainingFree the current amount of taxable free space
+	 */
+	void sampleAllocationRate(MM_EnvironmentBase *env, uintptr_t remainingFree);
+
+	/**
+	 * Predict whether free space will be exhausted before a concurrent cycle started now could complete.
+	 * The allocation rate is bounded from above using the smoothed variance so that marking completes with
+	 * at least the probability given by concurrentKickoffForecastConfidence.
+	 * @param remainingFree the current amount of taxable free space
+	 * @return true if concurrent should be kicked off now, false otherwise
+	 */
+	bool forecastExhaustionBeforeMarkComplete(MM_EnvironmentBase *env, uintptr_t remainingFree);
+
+	/**
+	 * Update the smoothed concurrent marking rate from the work done by the cycle that is ending.
+	 * @param executionModeAtGC the concurrent execution mode when the STW collection was triggered
+	 */
+	void updateForecastMarkRate(MM_EnvironmentBase *env, uintptr_t executionModeAtGC);
+
+	/**
+	 * Add the tax due for an allocation to the mutator's debt and decide how much of the debt to pay now.
+	 * Small debts are deferred while background helper threads are marking, and a single payment is limited
+	 * to what the mutator can trace in concurrentAssistMaxLatency unless the debt has grown too large.
+	 * @param taxDue the tax calculated for the current allocation
+	 * @return the amount of tracing the mutator should do now
+	 */
+	uintptr_t calculateAssistPayment(MM_EnvironmentBase *env, uintptr_t taxDue);
+
+	/**
+	 * Settle the mutator's debt after it has traced on behalf of an allocation.
+	 * @param payment the amount of tracing that was requested
+	 * @param paid the amount of tracing actually done
+	 * @param elapsedMicros the time spent tracing
+	 */
+	void settleAssistDebt(MM_EnvironmentBase *env, uintptr_t payment, uintptr_t paid, uint64_t elapsedMicros);
+
 	bool tracingRateDropped(MM_EnvironmentBase *env);
 #if defined(OMR_GC_MODRON_SCAVENGER)	
 	uintptr_t potentialFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
@@ -518,6 +586,15 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_forecastLastSampleTime(0)
+		,_forecastLastSampleFree(LAST_FREE_SIZE_NEEDS_INITIALIZING)
+		,_forecastSampleCount(0)
+		,_forecastAllocRate(0)
+		,_forecastAllocRateVariance(0)
+		,_forecastMarkRate(0)
+		,_forecastConfidenceFactor(0)
+		,_kickoffTime(0)
+		,_mutatorAssistMarkRate(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
@@ -0,0 +1,738 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include <string.h>
+
+#include "DominatorAnalysis.hpp"
+
+#include "omrgcconsts.h"
+#include "omrmodroncore.h"
+#include "ModronAssertions.h"
+
+#include "AtomicOperations.hpp"
+#include "Bits.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "ObjectModel.hpp"
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+#include <OMRClient/GC/ObjectScanner.hpp>
+#else /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+#include "ObjectIterator.hpp"
+#include "SlotObject.hpp"
+#endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+
+/* mark map slots per work unit, 1MB of heap on 64 bit platforms */
+#define DOMINATOR_ANALYSIS_CHUNK_SLOTS ((uintptr_t)2048)
+#define DOMINATOR_ANALYSIS_NO_NODE ((uint32_t)0xFFFFFFFF)
+
+/**
+ * Runs MM_DominatorAnalysis::buildGraph() on the GC threads.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_DominatorAnalysisTask : public MM_ParallelTask
+{
+private:
+	MM_DominatorAnalysis *_analysis;
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_DOMINATOR_ANALYSIS; };
+
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		_analysis->buildGraph(env);
+	}
+
+	MM_DominatorAnalysisTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_DominatorAnalysis *analysis)
+		: MM_ParallelTask(env, dispatcher)
+		, _analysis(analysis)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+struct MM_DominatorAnalysis::EdgeVisitor {
+	template <typename SlotHandleT>
+	bool edge(void *object, SlotHandleT&& slot) {
+		omrobjectptr_t referent = slot.readReference();
+		if (analysis->isNode(referent)) {
+			if (NULL != edges) {
+				edges[count] = analysis->getNode(referent);
+			}
+			count += 1;
+		}
+		return true;
+	}
+
+	MM_DominatorAnalysis *analysis;
+	uint32_t *edges;
+	uintptr_t count;
+};
+#endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+
+MM_DominatorAnalysis *
+MM_DominatorAnalysis::newInstance(MM_EnvironmentBase *env)
+{
+	MM_DominatorAnalysis *analysis = (MM_DominatorAnalysis *)env->getForge()->allocate(sizeof(MM_DominatorAnalysis), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != analysis) {
+		new(analysis) MM_DominatorAnalysis(env);
+		if (!analysis->initialize(env)) {
+			analysis->kill(env);
+			analysis = NULL;
+		}
+	}
+	return analysis;
+}
+
+void
+MM_DominatorAnalysis::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_DominatorAnalysis::MM_DominatorAnalysis(MM_EnvironmentBase *env)
+	: MM_BaseNonVirtual()
+	, _extensions(env->getExtensions())
+	, _markMap(NULL)
+	, _markBits(NULL)
+	, _heapBase(NULL)
+	, _heapTop(NULL)
+	, _objectGrain(0)
+	, _chunks(NULL)
+	, _chunkCount(0)
+	, _nodeCount(0)
+	, _edgeCount(0)
+	, _result(OMR_ERROR_NONE)
+	, _slotPrefix(NULL)
+	, _edgeOffsets(NULL)
+	, _edges(NULL)
+	, _predecessorOffsets(NULL)
+	, _predecessors(NULL)
+	, _retained(NULL)
+	, _dominators(NULL)
+	, _allocationCount(0)
+	, _nativeBytes(0)
+	, _fileCount(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_DominatorAnalysis::initialize(MM_EnvironmentBase *env)
+{
+	return true;
+}
+
+void
+MM_DominatorAnalysis::tearDown(MM_EnvironmentBase *env)
+{
+	freeArrays(env);
+}
+
+void *
+MM_DominatorAnalysis::allocateArray(MM_EnvironmentBase *env, uintptr_t count, uintptr_t elementSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	Assert_MM_true(_allocationCount < (sizeof(_allocations) / sizeof(_allocations[0])));
+	Allocation *allocation = &_allocations[_allocationCount];
+	uintptr_t size = OMR_MAX(count, 1) * elementSize;
+
+	allocation->memory = NULL;
+	allocation->size = size;
+	allocation->mapping = NULL;
+	allocation->fileName[0] = '\0';
+	if (size <= (_extensions->dominatorAnalysisMemoryLimit - _nativeBytes)) {
+		allocation->memory = env->getForge()->allocate(size, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL != allocation->memory) {
+			_nativeBytes += size;
+		}
+	} else if (0 == omrsysinfo_get_tmp(allocation->fileName, sizeof(allocation->fileName), FALSE)) {
+		/* back the array with a temporary file, freeArrays() removes it again */
+		uintptr_t length = strlen(allocation->fileName);
+		const char *separator = ((0 < length) && (DIR_SEPARATOR == allocation->fileName[length - 1])) ? "" : DIR_SEPARATOR_STR;
+		omrstr_printf(allocation->fileName + length, sizeof(allocation->fileName) - length, "%somrgc_dominators_%zu_%zu.tmp", separator, (size_t)omrsysinfo_get_pid(), (size_t)_fileCount);
+		_fileCount += 1;
+		intptr_t fd = omrfile_open(allocation->fileName, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0600);
+		if (-1 != fd) {
+			if (0 == omrfile_set_length(fd, (int64_t)size)) {
+				allocation->mapping = omrmmap_map_file(fd, 0, size, NULL, OMRPORT_MMAP_FLAG_WRITE, OMRMEM_CATEGORY_MM);
+			}
+			omrfile_close(fd);
+			if ((NULL != allocation->mapping) && (NULL != allocation->mapping->pointer)) {
+				allocation->memory = allocation->mapping->pointer;
+			} else {
+				if (NULL != allocation->mapping) {
+					omrmmap_unmap_file(allocation->mapping);
+					allocation->mapping = NULL;
+				}
+				omrfile_unlink(allocation->fileName);
+			}
+		}
+	}
+
+	if (NULL != allocation->memory) {
+		_allocationCount += 1;
+	}
+	return allocation->memory;
+}
+
+void
+MM_DominatorAnalysis::freeArrays(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	for (uintptr_t i = 0; i < _allocationCount; i++) {
+		Allocation *allocation = &_allocations[i];
+		if (NULL != allocation->mapping) {
+			omrmmap_unmap_file(allocation->mapping);
+			omrfile_unlink(allocation->fileName);
+		} else {
+			env->getForge()->free(allocation->memory);
+		}
+	}
+	_allocationCount = 0;
+	_nativeBytes = 0;
+}
+
+bool
+MM_DominatorAnalysis::buildChunks(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = _extensions->heap->getHeapRegionManager();
+	MM_HeapRegionDescriptor *region = NULL;
+
+	/* regions are visited in address order.  Two regions may share a mark map slot: it belongs to the first one */
+	for (uintptr_t pass = 0; pass < 2; pass++) {
+		uintptr_t chunkCount = 0;
+		uintptr_t previousSlotHigh = 0;
+		GC_HeapRegionIterator regionIterator(regionManager);
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if ((MEMORY_TYPE_RAM == (region->getTypeFlags() & MEMORY_TYPE_RAM)) && (0 != region->getSize())) {
+				uintptr_t slot = OMR_MAX(_markMap->getSlotIndex((omrobjectptr_t)region->getLowAddress()), previousSlotHigh);
+				uintptr_t slotHigh = _markMap->getSlotIndex((omrobjectptr_t)((uintptr_t)region->getHighAddress() - 1)) + 1;
+				while (slot < slotHigh) {
+					uintptr_t chunkSlotHigh = OMR_MIN(slot + DOMINATOR_ANALYSIS_CHUNK_SLOTS, slotHigh);
+					if (NULL != _chunks) {
+						_chunks[chunkCount].slotLow = slot;
+						_chunks[chunkCount].slotHigh = chunkSlotHigh;
+					}
+					chunkCount += 1;
+					slot = chunkSlotHigh;
+				}
+				previousSlotHigh = OMR_MAX(previousSlotHigh, slotHigh);
+			}
+		}
+		if (NULL == _chunks) {
+			_chunks = (Chunk *)allocateArray(env, chunkCount, sizeof(Chunk));
+			if (NULL == _chunks) {
+				return false;
+			}
+		}
+		_chunkCount = chunkCount;
+	}
+
+	uintptr_t heapSlots = _markMap->getSlotIndex((omrobjectptr_t)((uintptr_t)_heapTop - 1)) + 1;
+	_slotPrefix = (uint32_t *)allocateArray(env, heapSlots, sizeof(uint32_t));
+	return NULL != _slotPrefix;
+}
+
+uintptr_t
+MM_DominatorAnalysis::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uint32_t *edges)
+{
+	uintptr_t count = 0;
+
+	omrobjectptr_t indirectObject = _extensions->objectModel.getIndirectObject(objectPtr);
+	if (isNode(indirectObject)) {
+		if (NULL != edges) {
+			edges[count] = getNode(indirectObject);
+		}
+		count += 1;
+	}
+
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+	EdgeVisitor visitor;
+	visitor.analysis = this;
+	visitor.edges = (NULL != edges) ? (edges + count) : NULL;
+	visitor.count = 0;
+	OMRClient::GC::ObjectScanner scanner = _extensions->objectModel.makeObjectScanner();
+	scanner.start(visitor, objectPtr);
+	count += visitor.count;
+#else /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+	GC_ObjectIterator objectIterator(env->getOmrVM(), objectPtr);
+	GC_SlotObject *slotObject = NULL;
+	while (NULL != (slotObject = objectIterator.nextSlot())) {
+		omrobjectptr_t referent = slotObject->readReferenceFromSlot();
+		if (isNode(referent)) {
+			if (NULL != edges) {
+				edges[count] = getNode(referent);
+			}
+			count += 1;
+		}
+	}
+#endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+
+	return count;
+}
+
+void
+MM_DominatorAnalysis::buildGraph(MM_EnvironmentBase *env)
+{
+	/* count the objects of every chunk, and the rank of every slot within its chunk */
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			Chunk *chunk = &_chunks[i];
+			uint32_t nodeCount = 0;
+			for (uintptr_t slot = chunk->slotLow; slot < chunk->slotHigh; slot++) {
+				_slotPrefix[slot] = nodeCount;
+				nodeCount += (uint32_t)MM_Bits::populationCount(_markBits[slot]);
+			}
+			chunk->nodeCount = nodeCount;
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t nodeCount = 0;
+		for (uintptr_t i = 0; i < _chunkCount; i++) {
+			_chunks[i].firstNode = (uint32_t)nodeCount;
+			nodeCount += _chunks[i].nodeCount;
+			if (nodeCount > DOMINATOR_ANALYSIS_MAXIMUM_NODES) {
+				_result = OMR_ERROR_NOT_AVAILABLE;
+				break;
+			}
+		}
+		if (OMR_ERROR_NONE == _result) {
+			_nodeCount = (uint32_t)nodeCount;
+			_edgeOffsets = (uintptr_t *)allocateArray(env, nodeCount + 1, sizeof(uintptr_t));
+			_retained = (uintptr_t *)allocateArray(env, nodeCount + 1, sizeof(uintptr_t));
+			if ((NULL == _edgeOffsets) || (NULL == _retained)) {
+				_result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+	if (OMR_ERROR_NONE != _result) {
+		return;
+	}
+
+	/* make the slot ranks global, then count the references of every object */
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			Chunk *chunk = &_chunks[i];
+			uint32_t node = chunk->firstNode;
+			uintptr_t edgeCount = 0;
+			for (uintptr_t slot = chunk->slotLow; slot < chunk->slotHigh; slot++) {
+				_slotPrefix[slot] += chunk->firstNode;
+				uintptr_t bits = _markBits[slot];
+				while (0 != bits) {
+					omrobjectptr_t objectPtr = (omrobjectptr_t)((uintptr_t)_heapBase + (slot << J9MODRON_HEAPMAP_INDEX_SHIFT) + (MM_Bits::leadingZeroes(bits) * _objectGrain));
+					bits &= bits - 1;
+					uintptr_t degree = scanObject(env, objectPtr, NULL);
+					_retained[node] = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					_edgeOffsets[node] = degree;
+					edgeCount += degree;
+					node += 1;
+				}
+			}
+			chunk->edgeCount = edgeCount;
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t edgeCount = 0;
+		for (uintptr_t i = 0; i < _chunkCount; i++) {
+			_chunks[i].firstEdge = edgeCount;
+			edgeCount += _chunks[i].edgeCount;
+		}
+		_edgeCount = edgeCount;
+		_edgeOffsets[_nodeCount] = edgeCount;
+		_retained[_nodeCount] = 0;
+		_edges = (uint32_t *)allocateArray(env, edgeCount, sizeof(uint32_t));
+		_predecessors = (uint32_t *)allocateArray(env, edgeCount, sizeof(uint32_t));
+		_predecessorOffsets = (volatile uintptr_t *)allocateArray(env, _nodeCount + 1, sizeof(uintptr_t));
+		if ((NULL == _edges) || (NULL == _predecessors) || (NULL == _predecessorOffsets)) {
+			_result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			memset((void *)_predecessorOffsets, 0, (_nodeCount + 1) * sizeof(uintptr_t));
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+	if (OMR_ERROR_NONE != _result) {
+		return;
+	}
+
+	/* record the references, turning the degrees into offsets, and count the references to every object */
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			Chunk *chunk = &_chunks[i];
+			uintptr_t edge = chunk->firstEdge;
+			for (uint32_t node = chunk->firstNode; node < (chunk->firstNode + chunk->nodeCount); node++) {
+				uintptr_t degree = _edgeOffsets[node];
+				_edgeOffsets[node] = edge;
+				edge += degree;
+			}
+			uint32_t node = chunk->firstNode;
+			for (uintptr_t slot = chunk->slotLow; slot < chunk->slotHigh; slot++) {
+				uintptr_t bits = _markBits[slot];
+				while (0 != bits) {
+					omrobjectptr_t objectPtr = (omrobjectptr_t)((uintptr_t)_heapBase + (slot << J9MODRON_HEAPMAP_INDEX_SHIFT) + (MM_Bits::leadingZeroes(bits) * _objectGrain));
+					bits &= bits - 1;
+					uintptr_t edgeBase = _edgeOffsets[node];
+					uintptr_t degree = scanObject(env, objectPtr, _edges + edgeBase);
+					for (uintptr_t j = edgeBase; j < (edgeBase + degree); j++) {
+						MM_AtomicOperations::add(&_predecessorOffsets[_edges[j]], 1);
+					}
+					node += 1;
+				}
+			}
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		/* every object ends where the next one starts.  The transpose is filled from the end of each object's range */
+		uintptr_t end = 0;
+		for (uint32_t node = 0; node < _nodeCount; node++) {
+			end += _predecessorOffsets[node];
+			_predecessorOffsets[node] = end;
+		}
+		_predecessorOffsets[_nodeCount] = end;
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* transpose the graph */
+	for (uintptr_t i = 0; i < _chunkCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			Chunk *chunk = &_chunks[i];
+			for (uint32_t node = chunk->firstNode; node < (chunk->firstNode + chunk->nodeCount); node++) {
+				for (uintptr_t j = _edgeOffsets[node]; j < _edgeOffsets[node + 1]; j++) {
+					uintptr_t position = MM_AtomicOperations::subtract(&_predecessorOffsets[_edges[j]], 1);
+					_predecessors[position] = node;
+				}
+			}
+		}
+	}
+}
+
+uint32_t
+MM_DominatorAnalysis::eval(uint32_t node, uint32_t *semi, uint32_t *ancestor, uint32_t *label, uint32_t *stack)
+{
+	if (DOMINATOR_ANALYSIS_NO_NODE == ancestor[node]) {
+		return node;
+	}
+
+	/* compress the path from node to the root of its forest tree, starting at the top */
+	uintptr_t depth = 0;
+	uint32_t current = node;
+	while (DOMINATOR_ANALYSIS_NO_NODE != ancestor[ancestor[current]]) {
+		stack[depth] = current;
+		depth += 1;
+		current = ancestor[current];
+	}
+	while (0 < depth) {
+		depth -= 1;
+		current = stack[depth];
+		uint32_t currentAncestor = ancestor[current];
+		if (semi[label[currentAncestor]] < semi[label[current]]) {
+			label[current] = label[currentAncestor];
+		}
+		ancestor[current] = ancestor[currentAncestor];
+	}
+	return label[node];
+}
+
+bool
+MM_DominatorAnalysis::computeDominators(MM_EnvironmentBase *env, omrobjectptr_t *roots, uintptr_t rootCount)
+{
+	uintptr_t nodeCount = (uintptr_t)_nodeCount + 1;
+	uint32_t rootNode = _nodeCount;
+
+	_dominators = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *semi = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *vertex = (uint32_t *)allocateArray(env, nodeCount + 1, sizeof(uint32_t));
+	uint32_t *parent = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *ancestor = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *label = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *bucket = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *bucketNext = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *stack = (uint32_t *)allocateArray(env, nodeCount, sizeof(uint32_t));
+	uint32_t *rootChildren = (uint32_t *)allocateArray(env, (nodeCount + 31) / 32, sizeof(uint32_t));
+	uint32_t *rootNodes = (uint32_t *)allocateArray(env, rootCount, sizeof(uint32_t));
+	if ((NULL == _dominators) || (NULL == semi) || (NULL == vertex) || (NULL == parent) || (NULL == ancestor)
+		|| (NULL == label) || (NULL == bucket) || (NULL == bucketNext) || (NULL == stack) || (NULL == rootChildren) || (NULL == rootNodes)
+	) {
+		return false;
+	}
+	memset(semi, 0, nodeCount * sizeof(uint32_t));
+	memset(rootChildren, 0, ((nodeCount + 31) / 32) * sizeof(uint32_t));
+
+	/* the root node references the given roots.  Objects unreachable from them hang off it as well, those nothing
+	 * references first, so that the rest of such a structure is found below them
+	 */
+	uintptr_t rootNodeCount = 0;
+	for (uintptr_t i = 0; i < rootCount; i++) {
+		if (isNode(roots[i])) {
+			uint32_t node = getNode(roots[i]);
+			rootNodes[rootNodeCount] = node;
+			rootNodeCount += 1;
+			rootChildren[node >> 5] |= ((uint32_t)1 << (node & 31));
+		}
+	}
+	uintptr_t rootCursor = 0;
+	uintptr_t rootSuccessors = rootNodeCount + (2 * (uintptr_t)_nodeCount);
+
+	/* depth first numbering, semi[] holds the numbers (from 1) and label[] the next edge to follow of nodes on the stack */
+	uint32_t count = 1;
+	semi[rootNode] = count;
+	vertex[count] = rootNode;
+	stack[0] = rootNode;
+	uintptr_t depth = 1;
+	while (0 < depth) {
+		uint32_t node = stack[depth - 1];
+		uint32_t next = DOMINATOR_ANALYSIS_NO_NODE;
+		if (rootNode == node) {
+			while ((DOMINATOR_ANALYSIS_NO_NODE == next) && (rootCursor < rootSuccessors)) {
+				uint32_t candidate = 0;
+				bool unreferenced = true;
+				if (rootCursor < rootNodeCount) {
+					candidate = rootNodes[rootCursor];
+				} else if (rootCursor < (rootNodeCount + _nodeCount)) {
+					candidate = (uint32_t)(rootCursor - rootNodeCount);
+					unreferenced = (_predecessorOffsets[candidate] == _predecessorOffsets[candidate + 1]);
+				} else {
+					candidate = (uint32_t)(rootCursor - rootNodeCount - _nodeCount);
+				}
+				rootCursor += 1;
+				if (unreferenced && (0 == semi[candidate])) {
+					rootChildren[candidate >> 5] |= ((uint32_t)1 << (candidate & 31));
+					next = candidate;
+				}
+			}
+		} else {
+			uintptr_t edge = _edgeOffsets[node] + label[node];
+			while ((DOMINATOR_ANALYSIS_NO_NODE == next) && (edge < _edgeOffsets[node + 1])) {
+				uint32_t candidate = _edges[edge];
+				edge += 1;
+				if (0 == semi[candidate]) {
+					next = candidate;
+				}
+			}
+			label[node] = (uint32_t)(edge - _edgeOffsets[node]);
+		}
+
+		if (DOMINATOR_ANALYSIS_NO_NODE == next) {
+			depth -= 1;
+		} else {
+			count += 1;
+			semi[next] = count;
+			vertex[count] = next;
+			parent[next] = node;
+			label[next] = 0;
+			stack[depth] = next;
+			depth += 1;
+		}
+	}
+	Assert_MM_true(count == nodeCount);
+
+	/* Lengauer-Tarjan: semidominators in reverse depth first order, then implicit immediate dominators */
+	for (uintptr_t node = 0; node < nodeCount; node++) {
+		ancestor[node] = DOMINATOR_ANALYSIS_NO_NODE;
+		label[node] = (uint32_t)node;
+		bucket[node] = DOMINATOR_ANALYSIS_NO_NODE;
+	}
+	for (uint32_t i = count; i > 1; i--) {
+		uint32_t node = vertex[i];
+		for (uintptr_t j = _predecessorOffsets[node]; j < _predecessorOffsets[node + 1]; j++) {
+			uint32_t evaluated = eval(_predecessors[j], semi, ancestor, label, stack);
+			if (semi[evaluated] < semi[node]) {
+				semi[node] = semi[evaluated];
+			}
+		}
+		if (0 != (rootChildren[node >> 5] & ((uint32_t)1 << (node & 31)))) {
+			semi[node] = semi[rootNode];
+		}
+		uint32_t semidominator = vertex[semi[node]];
+		bucketNext[node] = bucket[semidominator];
+		bucket[semidominator] = node;
+
+		uint32_t nodeParent = parent[node];
+		ancestor[node] = nodeParent;
+		for (uint32_t dominated = bucket[nodeParent]; DOMINATOR_ANALYSIS_NO_NODE != dominated; dominated = bucketNext[dominated]) {
+			uint32_t evaluated = eval(dominated, semi, ancestor, label, stack);
+			_dominators[dominated] = (semi[evaluated] < semi[dominated]) ? evaluated : nodeParent;
+		}
+		bucket[nodeParent] = DOMINATOR_ANALYSIS_NO_NODE;
+	}
+	for (uint32_t i = 2; i <= count; i++) {
+		uint32_t node = vertex[i];
+		if (_dominators[node] != vertex[semi[node]]) {
+			_dominators[node] = _dominators[_dominators[node]];
+		}
+	}
+	_dominators[rootNode] = DOMINATOR_ANALYSIS_NO_NODE;
+
+	/* a dominator precedes everything it dominates in depth first order */
+	for (uint32_t i = count; i > 1; i--) {
+		uint32_t node = vertex[i];
+		_retained[_dominators[node]] += _retained[node];
+	}
+
+	return true;
+}
+
+uintptr_t
+MM_DominatorAnalysis::selectLargest(MM_EnvironmentBase *env, uint32_t *largest, uintptr_t capacity)
+{
+	/* keep a min-heap of the largest nodes seen so far */
+	uintptr_t size = 0;
+	for (uint32_t node = 0; node < _nodeCount; node++) {
+		uintptr_t hole = 0;
+		if (size < capacity) {
+			hole = size;
+			size += 1;
+			while ((0 < hole) && (_retained[largest[(hole - 1) / 2]] > _retained[node])) {
+				largest[hole] = largest[(hole - 1) / 2];
+				hole = (hole - 1) / 2;
+			}
+		} else if (_retained[largest[0]] < _retained[node]) {
+			while (((2 * hole) + 1) < size) {
+				uintptr_t child = (2 * hole) + 1;
+				if (((child + 1) < size) && (_retained[largest[child + 1]] < _retained[largest[child]])) {
+					child += 1;
+				}
+				if (_retained[largest[child]] >= _retained[node]) {
+					break;
+				}
+				largest[hole] = largest[child];
+				hole = child;
+			}
+		} else {
+			continue;
+		}
+		largest[hole] = node;
+	}
+
+	/* pop the smallest to the end until the array is sorted largest first */
+	for (uintptr_t end = size; end > 1; end--) {
+		uint32_t smallest = largest[0];
+		uint32_t node = largest[end - 1];
+		uintptr_t hole = 0;
+		while (((2 * hole) + 1) < (end - 1)) {
+			uintptr_t child = (2 * hole) + 1;
+			if (((child + 1) < (end - 1)) && (_retained[largest[child + 1]] < _retained[largest[child]])) {
+				child += 1;
+			}
+			if (_retained[largest[child]] >= _retained[node]) {
+				break;
+			}
+			largest[hole] = largest[child];
+			hole = child;
+		}
+		largest[hole] = node;
+		largest[end - 1] = smallest;
+	}
+	return size;
+}
+
+omrobjectptr_t
+MM_DominatorAnalysis::getObject(uint32_t node)
+{
+	/* find the last chunk starting at or before the node, then the node in its slots */
+	uintptr_t low = 0;
+	uintptr_t high = _chunkCount;
+	while ((low + 1) < high) {
+		uintptr_t middle = (low + high) / 2;
+		if (_chunks[middle].firstNode <= node) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	Chunk *chunk = &_chunks[low];
+	uintptr_t remaining = node - chunk->firstNode;
+	for (uintptr_t slot = chunk->slotLow; slot < chunk->slotHigh; slot++) {
+		uintptr_t bits = _markBits[slot];
+		uintptr_t slotCount = MM_Bits::populationCount(bits);
+		if (remaining < slotCount) {
+			while (0 < remaining) {
+				bits &= bits - 1;
+				remaining -= 1;
+			}
+			return (omrobjectptr_t)((uintptr_t)_heapBase + (slot << J9MODRON_HEAPMAP_INDEX_SHIFT) + (MM_Bits::leadingZeroes(bits) * _objectGrain));
+		}
+		remaining -= slotCount;
+	}
+	Assert_MM_unreachable();
+	return NULL;
+}
+
+omr_error_t
+MM_DominatorAnalysis::analyze(MM_EnvironmentBase *env, MM_MarkMap *markMap, omrobjectptr_t *roots, uintptr_t rootCount, OMR_GC_RetainedSize *results, uintptr_t *resultCount)
+{
+	_markMap = markMap;
+	_markBits = markMap->getHeapMapBits();
+	_heapBase = _extensions->heap->getHeapBase();
+	_heapTop = _extensions->heap->getHeapTop();
+	_objectGrain = markMap->getObjectGrain();
+	_result = OMR_ERROR_NONE;
+
+	if (!buildChunks(env)) {
+		_result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	} else {
+		MM_DominatorAnalysisTask analysisTask(env, _extensions->dispatcher, this);
+		_extensions->dispatcher->run(env, &analysisTask);
+	}
+	if ((OMR_ERROR_NONE == _result) && !computeDominators(env, roots, rootCount)) {
+		_result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+	}
+
+	uintptr_t filled = 0;
+	if (OMR_ERROR_NONE == _result) {
+		uint32_t *largest = (uint32_t *)allocateArray(env, *resultCount, sizeof(uint32_t));
+		if (NULL == largest) {
+			_result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		} else {
+			filled = selectLargest(env, largest, *resultCount);
+			for (uintptr_t i = 0; i < filled; i++) {
+				uint32_t node = largest[i];
+				uint32_t dominator = _dominators[node];
+				results[i].object = getObject(node);
+				results[i].dominator = (_nodeCount == dominator) ? NULL : getObject(dominator);
+				results[i].shallowSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(results[i].object);
+				results[i].retainedSize = _retained[node];
+			}
+		}
+	}
+	*resultCount = filled;
+
+	freeArrays(env);
+	return _result;
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(DOMINATORANALYSIS_HPP_)
+#define DOMINATORANALYSIS_HPP_
+
+#include "omrcfg.h"
+#include "omrgc.h"
+#include "omrport.h"
+
+#include "BaseNonVirtual.hpp"
+#include "MarkMap.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Largest number of live objects the analysis supports.  Nodes are 32 bit and two values are reserved for the roots
+ * and for "no node".
+ */
+#define DOMINATOR_ANALYSIS_MAXIMUM_NODES ((uintptr_t)0xFFFFFFF0)
+
+/**
+ * Computes the dominator tree of the live heap and the retained size of every live object.
+ *
+ * The analysis runs with exclusive VM access on a freshly marked heap.  Live objects are numbered by their rank in
+ * the mark map (the number of mark bits below them), so an object is mapped to its node without a side table:
+ * _slotPrefix holds the rank of the first object of every mark map slot, and a population count of the slot finds
+ * the rest.  One extra node, numbered _nodeCount, stands for the roots.
+ *
+ * The GC threads build a compressed (CSR) edge array of the object graph from the mark map in one parallel task,
+ * together with its transpose.  The master thread then runs Lengauer-Tarjan with path compression over it and
+ * accumulates retained sizes in reverse depth first order.
+ *
+ * Nodes and edges are 32 bit.  All arrays whose size depends on the heap are allocated through allocateArray(), which
+ * backs them with temporary memory mapped files once dominatorAnalysisMemoryLimit bytes of native memory are in use.
+ */
+class MM_DominatorAnalysis : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * A run of mark map slots processed as one work unit.  Chunks are in address order, so their node and edge
+	 * ranges are too.
+	 */
+	struct Chunk {
+		uintptr_t slotLow; /**< first mark map slot of the chunk */
+		uintptr_t slotHigh; /**< slot after the last one */
+		uint32_t firstNode; /**< rank of the first object in the chunk */
+		uint32_t nodeCount;
+		uintptr_t firstEdge; /**< index of the first outgoing edge of the chunk's objects */
+		uintptr_t edgeCount;
+	};
+
+	/**
+	 * An array allocated by allocateArray()
+	 */
+	struct Allocation {
+		void *memory;
+		uintptr_t size;
+		J9MmapHandle *mapping; /**< NULL if the array is native memory */
+		char fileName[EsMaxPath];
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	MM_MarkMap *_markMap;
+	uintptr_t *_markBits; /**< the mark map slots */
+	void *_heapBase;
+	void *_heapTop;
+	uintptr_t _objectGrain;
+
+	Chunk *_chunks;
+	uintptr_t _chunkCount;
+
+	uint32_t _nodeCount; /**< number of live objects, also the node of the roots */
+	uintptr_t _edgeCount;
+	omr_error_t _result; /**< set by the master thread when the graph can not be built */
+
+	uint32_t *_slotPrefix; /**< rank of the first object of every mark map slot */
+	uintptr_t *_edgeOffsets; /**< outgoing edges of node n are _edges[_edgeOffsets[n]] to _edges[_edgeOffsets[n + 1] - 1] */
+	uint32_t *_edges;
+	volatile uintptr_t *_predecessorOffsets; /**< the transpose of _edgeOffsets/_edges */
+	uint32_t *_predecessors;
+	uintptr_t *_retained; /**< shallow sizes, then retained sizes, of all nodes */
+	uint32_t *_dominators; /**< immediate dominator of every node */
+
+	Allocation _allocations[32];
+	uintptr_t _allocationCount;
+	uintptr_t _nativeBytes; /**< native memory held by _allocations */
+	uintptr_t _fileCount; /**< used to name the temporary files */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_DominatorAnalysis *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Run the analysis.  The caller must hold exclusive VM access and the mark map must be valid.
+	 * @param env[in] the master thread
+	 * @param roots[in] objects to treat as roots, entries outside the heap or not marked are ignored
+	 * @param rootCount[in] number of entries in roots
+	 * @param results[out] the objects with the largest retained sizes, largest first
+	 * @param resultCount[in/out] capacity of results on entry, number of entries filled in on return
+	 * @return OMR_ERROR_NONE, OMR_ERROR_OUT_OF_NATIVE_MEMORY or OMR_ERROR_NOT_AVAILABLE if there are too many objects
+	 */
+	omr_error_t analyze(MM_EnvironmentBase *env, MM_MarkMap *markMap, omrobjectptr_t *roots, uintptr_t rootCount, OMR_GC_RetainedSize *results, uintptr_t *resultCount);
+
+	/**
+	 * Build the edge arrays.  Run by every thread of the analysis task.
+	 * @param env[in] a GC thread
+	 */
+	void buildGraph(MM_EnvironmentBase *env);
+
+	MM_DominatorAnalysis(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+private:
+	void *allocateArray(MM_EnvironmentBase *env, uintptr_t count, uintptr_t elementSize);
+	void freeArrays(MM_EnvironmentBase *env);
+
+	bool buildChunks(MM_EnvironmentBase *env);
+	bool computeDominators(MM_EnvironmentBase *env, omrobjectptr_t *roots, uintptr_t rootCount);
+	uintptr_t selectLargest(MM_EnvironmentBase *env, uint32_t *largest, uintptr_t capacity);
+	omrobjectptr_t getObject(uint32_t node);
+
+	/**
+	 * Count or record the references of an object to other live objects.
+	 * @param edges[out] where to record the nodes referenced, NULL to only count them
+	 * @return the number of references
+	 */
+	uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uint32_t *edges);
+
+	MMINLINE bool
+	isNode(omrobjectptr_t objectPtr)
+	{
+		return ((void *)objectPtr >= _heapBase) && ((void *)objectPtr < _heapTop) && _markMap->isBitSet(objectPtr);
+	}
+
+	MMINLINE uint32_t
+	getNode(omrobjectptr_t objectPtr)
+	{
+		uintptr_t slotIndex = 0;
+		uintptr_t bitMask = 0;
+		_markMap->getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+		return _slotPrefix[slotIndex] + (uint32_t)MM_Bits::populationCount(_markBits[slotIndex] & (bitMask - 1));
+	}
+
+	/**
+	 * Lengauer-Tarjan EVAL with iterative path compression.
+	 */
+	uint32_t eval(uint32_t node, uint32_t *semi, uint32_t *ancestor, uint32_t *label, uint32_t *stack);
+
+#if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
+	struct EdgeVisitor;
+#endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
+};
+
+#endif /* DOMINATORANALYSIS_HPP_ */
@@ -47,7 +47,7 @@ class MM_EnvironmentStandard : public MM_EnvironmentBase
 {
 /* Data Section */
 public:
-	MM_CopyScanCacheStandard *_survivorCopyScanCache; /**< the current copy cache for flipping */
+	MM_CopyScanCacheStandard *_survivorCopyScanCaches[SCAVENGER_SURVIVOR_AGE_STREAMS_MAX]; /**< the current copy caches for flipping, one per survivor age stream (only the first is used unless age streams are enabled) */
 	MM_CopyScanCacheStandard *_scanCache; /**< the current scan cache */
 	MM_CopyScanCacheStandard *_deferredScanCache; /**< a copy cache about to be pushed to scan queue, but before that may be merged with some other caches that collectively form contiguous memory */
 	MM_CopyScanCacheStandard *_deferredCopyCache; /**< a copy cache about to be pushed to scan queue, but before that may be merged with some other caches that collectively form contiguous memory */
@@ -84,7 +84,6 @@ public:
 
 	MM_EnvironmentStandard(OMR_VMThread *omrVMThread) :
 		MM_EnvironmentBase(omrVMThread)
-		,_survivorCopyScanCache(NULL)
 		,_scanCache(NULL)
 		,_deferredScanCache(NULL)
 		,_deferredCopyCache(NULL)
@@ -97,6 +96,9 @@ public:
 		,_survivorTLHRemainderTop(NULL)
 	{
 		_typeId = __FUNCTION__;
+		for (uintptr_t stream = 0; stream < SCAVENGER_SURVIVOR_AGE_STREAMS_MAX; stream++) {
+			_survivorCopyScanCaches[stream] = NULL;
+		}
 	}
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
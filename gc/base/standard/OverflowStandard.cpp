@@ -103,9 +103,18 @@ MM_OverflowStandard::overflowItemInternal(MM_EnvironmentBase *env, void *item)
 	void *heapBase = _extensions->heap->getHeapBase();
 	void *heapTop = _extensions->heap->getHeapTop();
 
+	MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
+	MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
+
+	if (markingScheme->isEdgeEntry(item)) {
+		/* an edge: mark its target now and overflow the target if this marked it */
+		item = (void *)markingScheme->resolveWorkStackEntry(env, item);
+		if (NULL == item) {
+			return;
+		}
+	}
+
 	if ((PACKET_ARRAY_SPLIT_TAG != ((uintptr_t)item & PACKET_ARRAY_SPLIT_TAG)) &&  (item >= heapBase) && (item < heapTop)) {
-		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
-		MM_MarkingScheme *markingScheme = globalCollector->getMarkingScheme();
 		MM_MarkMap *markMap = markingScheme->getMarkMap();
 		omrobjectptr_t objectPtr = (omrobjectptr_t)item;
 
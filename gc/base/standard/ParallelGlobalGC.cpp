@@ -41,6 +41,7 @@
 #include "EnvironmentBase.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "Heap.hpp"
+#include "HeapCensusManager.hpp"
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
@@ -840,16 +841,37 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 
 	_markingScheme->masterSetupForGC(env);
 
+	/* a census counts the objects marked by this task, which are all the live ones only if the mark map starts out clear */
+	bool collectCensus = (NULL != _extensions->heapCensusManager) && initMarkMap;
+	if (collectCensus) {
+		_extensions->heapCensusManager->cycleStart(env);
+	}
+
 	if (env->_cycleState->_gcCode.isOutOfMemoryGC()) {
 		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
 	}
 
 	/* run the mark */
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	/* a mark that completes a concurrent cycle only scans what concurrent marking left behind, so it neither measures nor is sized by the work of a full mark */
+	bool adaptiveThreading = _extensions->adaptiveGCThreading && initMarkMap;
+	uintptr_t threadCount = UDATA_MAX;
+	if (adaptiveThreading) {
+		threadCount = _adaptiveThreadCount.getThreadCount(_dispatcher->threadCount());
+		Trc_MM_ParallelGlobalGC_markAll_adaptiveThreadCount(env->getLanguageVMThread(), threadCount, _dispatcher->threadCount());
+	}
+	uintptr_t bytesScannedBefore = markStats->_bytesScanned;
+	_dispatcher->run(env, &markTask, threadCount);
+	if (adaptiveThreading) {
+		_adaptiveThreadCount.update(markStats->_bytesScanned - bytesScannedBefore, _extensions->adaptiveGCThreadingWorkPerThread, _dispatcher->threadCount());
+	}
 	
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
+	if (collectCensus) {
+		_extensions->heapCensusManager->cycleEnd(env, OMR_GC_CYCLE_TYPE_GLOBAL, true);
+	}
+
 	/* Do any post mark checks */
 	postMark(env);
 	_markingScheme->masterCleanupAfterGC(env);
@@ -1115,6 +1137,9 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, true, NULL);
 	_dispatcher->run(env, &markTask);
 
+	/* every mark bit now starts a live object, so parallel walks may split regions at marked objects */
+	_markingScheme->getMarkMap()->setMarkMapValid(true);
+
 	_delegate.prepareHeapForWalk(env);
 }
 
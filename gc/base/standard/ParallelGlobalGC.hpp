@@ -26,6 +26,7 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "AdaptiveThreadCount.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 #include "ConcurrentSweepScheme.hpp"
@@ -70,6 +71,7 @@ protected:
 	MM_ParallelSweepScheme *_sweepScheme;
 	MM_ParallelHeapWalker *_heapWalker;
 	MM_Dispatcher *_dispatcher;
+	MM_AdaptiveThreadCount _adaptiveThreadCount; /**< thread count for the next mark task, from the bytes scanned by the last one */
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
@@ -319,6 +321,7 @@ public:
 		, _sweepScheme(NULL)
 		, _heapWalker(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _adaptiveThreadCount()
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
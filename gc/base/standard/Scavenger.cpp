@@ -57,6 +57,7 @@
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
 #include "Heap.hpp"
+#include "HeapCensusManager.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -67,6 +68,7 @@
 #include "MemorySubSpaceRegionIterator.hpp"
 #include "MemorySubSpaceRegionIteratorStandard.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
+#include "NonTemporalCopy.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
@@ -263,6 +265,13 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		break;
 	}
 
+	/* each additional survivor age stream keeps another copy cache open (reserved by calculateTotalActiveCacheCount()) */
+	_survivorAgeStreams = OMR_MAX(OMR_MIN(_extensions->scavengerSurvivorAgeStreams, (uintptr_t)SCAVENGER_SURVIVOR_AGE_STREAMS_MAX), 1);
+	_cachesPerThread += _survivorAgeStreams - 1;
+	for (uintptr_t age = 0; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		_survivorAgeStream[age] = 0;
+	}
+
 	/**
 	 *incrementNewSpaceSize = 
 	 *  Xmnx <= 32MB		---> Xmnx
@@ -274,10 +283,7 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	incrementNewSpaceSize = OMR_MIN(incrementNewSpaceSize, 256*1024*1024);
 
 	uintptr_t incrementCacheCount = incrementNewSpaceSize / _extensions->scavengerScanCacheMinimumSize;
-	uintptr_t totalActiveCacheCount = _extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW) / _extensions->scavengerScanCacheMinimumSize;
-	if (0 == totalActiveCacheCount) {
-		totalActiveCacheCount += 1;
-	}
+	uintptr_t totalActiveCacheCount = calculateTotalActiveCacheCount(_extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW));
 
 
 	if (!_scavengeCacheFreeList.resizeCacheEntries(env, totalActiveCacheCount, incrementCacheCount)) {
@@ -412,6 +418,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 
 	/* Record the tenure mask */
 	_tenureMask = calculateTenureMask();
+	calculateSurvivorAgeStreams();
 	
 	_activeSubSpace->masterSetupForGC(env);
 
@@ -421,6 +428,11 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
+
+	/* a concurrent scavenge copies objects outside of the GC threads' work, so it is not counted */
+	if ((NULL != _extensions->heapCensusManager) && !IS_CONCURRENT_ENABLED) {
+		_extensions->heapCensusManager->cycleStart(env);
+	}
 }
 
 void
@@ -441,8 +453,14 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
 
+	if (NULL != _extensions->heapCensusManager) {
+		_extensions->heapCensusManager->threadStart(env);
+	}
+
 	/* caches should all be reset */
-	Assert_MM_true(NULL == env->_survivorCopyScanCache);
+	for (uintptr_t stream = 0; stream < SCAVENGER_SURVIVOR_AGE_STREAMS_MAX; stream++) {
+		Assert_MM_true(NULL == env->_survivorCopyScanCaches[stream]);
+	}
 	Assert_MM_true(NULL == env->_tenureCopyScanCache);
 	Assert_MM_true(NULL == env->_deferredScanCache);
 	Assert_MM_true(NULL == env->_deferredCopyCache);
@@ -459,7 +477,18 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
-	_dispatcher->run(env, &scavengeTask);
+	uintptr_t threadCount = UDATA_MAX;
+	if (_extensions->adaptiveGCThreading) {
+		threadCount = _adaptiveThreadCount.getThreadCount(_dispatcher->threadCount());
+		Trc_MM_Scavenger_scavenge_adaptiveThreadCount(env->getLanguageVMThread(), threadCount, _dispatcher->threadCount());
+	}
+	_dispatcher->run(env, &scavengeTask, threadCount);
+
+	/* the work this scavenge did sizes the next one; a backed out scavenge stopped early, so it says little */
+	if (!isBackOutFlagRaised()) {
+		uintptr_t bytesCopied = _extensions->incrementScavengerStats._flipBytes + _extensions->incrementScavengerStats._tenureAggregateBytes;
+		_adaptiveThreadCount.update(bytesCopied, _extensions->adaptiveGCThreadingWorkPerThread, _dispatcher->threadCount());
+	}
 
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
@@ -700,6 +729,16 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
+	for (uintptr_t i = 0; i < OMR_SCAVENGER_COPYSIZE_BINS; i++) {
+		finalGCStats->_copy_size_bytes[i] += scavStats->_copy_size_bytes[i];
+		finalGCStats->_copy_size_counts[i] += scavStats->_copy_size_counts[i];
+	}
+	finalGCStats->_nonTemporalCopyCount += scavStats->_nonTemporalCopyCount;
+	finalGCStats->_nonTemporalCopyBytes += scavStats->_nonTemporalCopyBytes;
+	for (uintptr_t stream = 0; stream < SCAVENGER_SURVIVOR_AGE_STREAMS_MAX; stream++) {
+		finalGCStats->_survivorAgeStreamFlipCounts[stream] += scavStats->_survivorAgeStreamFlipCounts[stream];
+		finalGCStats->_survivorAgeStreamFlipBytes[stream] += scavStats->_survivorAgeStreamFlipBytes[stream];
+	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
@@ -893,11 +932,12 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 }
 
 MMINLINE MM_CopyScanCacheStandard *
-MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes)
+MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes, uintptr_t survivorAgeStream)
 {
 	void* addrBase = NULL;
 	void* addrTop = NULL;
 	MM_CopyScanCacheStandard *copyCache = NULL;
+	MM_CopyScanCacheStandard **survivorCopyScanCache = &env->_survivorCopyScanCaches[survivorAgeStream];
 	uintptr_t cacheSize = objectReserveSizeInBytes;
 
 	Assert_MM_objectAligned(env, objectReserveSizeInBytes);
@@ -906,9 +946,9 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 	 * Please note that condition like (top >= start + size) might cause wrong functioning due overflow
 	 * so to be safe (top - start >= size) must be used
 	 */
-	if ((NULL != env->_survivorCopyScanCache) && (((uintptr_t)env->_survivorCopyScanCache->cacheTop - (uintptr_t)env->_survivorCopyScanCache->cacheAlloc) >= cacheSize)) {
+	if ((NULL != *survivorCopyScanCache) && (((uintptr_t)(*survivorCopyScanCache)->cacheTop - (uintptr_t)(*survivorCopyScanCache)->cacheAlloc) >= cacheSize)) {
 		/* A survivor copy scan cache exists and there is a room, use the current copy cache */
-		copyCache = env->_survivorCopyScanCache;
+		copyCache = *survivorCopyScanCache;
 	} else {
 		/* The copy cache was null or did not have enough room */
 		/* Try and allocate room for the copy - if successful, flush the old cache */
@@ -946,7 +986,7 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 			/* A new chunk has been allocated - refresh the copy cache */
 
 			/* release local cache first. along the path we may realize that a cache structure can be re-used */
-			MM_CopyScanCacheStandard *cacheToReuse = releaseLocalCopyCache(env, env->_survivorCopyScanCache);
+			MM_CopyScanCacheStandard *cacheToReuse = releaseLocalCopyCache(env, *survivorCopyScanCache);
 
 			if (NULL == cacheToReuse) {
 				/* So, we need a new cache - try to get reserved one*/
@@ -971,7 +1011,7 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				_survivorMemorySubSpace->abandonHeapChunk(addrBase, addrTop);
 			}
 
-			env->_survivorCopyScanCache = copyCache;
+			*survivorCopyScanCache = copyCache;
 		} else {
 			/* Can not allocate requested memory in survivor subspace */
 			/* Record size to reduce multiple failure attempts
@@ -1213,6 +1253,12 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard* env, omrobjectptr_t object)
 
 	return result;
 }
+
+bool
+ScavengingRootVisitor::edge(void* object, OMR::GC::RefSlotHandle slot) noexcept
+{
+	return edge<OMR::GC::RefSlotHandle>(object, slot);
+}
 #endif /* OMR_GC_EXPERIMENTAL_OBJECT_SCANNER */
 
 #if !defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
@@ -1388,7 +1434,7 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 
 	if (0 == (((uintptr_t)1 << objectAge) & _tenureMask)) {
 		/* The object should be flipped - try to reserve room in the semi space */
-		copyCache = reserveMemoryForAllocateInSemiSpace(env, forwardedHeader->getObject(), objectReserveSizeInBytes);
+		copyCache = reserveMemoryForAllocateInSemiSpace(env, forwardedHeader->getObject(), objectReserveSizeInBytes, getSurvivorAgeStream(objectAge));
 		if (NULL != copyCache) {
 			/* Adjust the age value*/
 			if(objectAge < OBJECT_HEADER_AGE_MAX) {
@@ -1440,7 +1486,7 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 					"Corruption in Evacuate at %p: calculated object size %zu larger then available %zu, Forwarded Header at %p\n",
 					forwardedHeader->getObject(), objectCopySizeInBytes, spaceAvailableForObject, forwardedHeader);
 
-			copyCache = reserveMemoryForAllocateInSemiSpace(env, forwardedHeader->getObject(), objectReserveSizeInBytes);
+			copyCache = reserveMemoryForAllocateInSemiSpace(env, forwardedHeader->getObject(), objectReserveSizeInBytes, getSurvivorAgeStream(objectAge));
 			if (NULL != copyCache) {
 				/* Adjust the age value*/
 				if(objectAge < OBJECT_HEADER_AGE_MAX) {
@@ -1552,7 +1598,14 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 		} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		{
-			memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			uintptr_t nonTemporalCopyThreshold = _extensions->scavengerNonTemporalCopyThreshold;
+			if ((0 != nonTemporalCopyThreshold) && (objectCopySizeInBytes >= nonTemporalCopyThreshold)) {
+				MM_NonTemporalCopy::copy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+				env->_scavengerStats._nonTemporalCopyCount += 1;
+				env->_scavengerStats._nonTemporalCopyBytes += objectCopySizeInBytes;
+			} else {
+				memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			}
 
 			/* Copy the preserved fields from the forwarded header into the destination object */
 			forwardedHeader->fixupForwardedObject(destinationObjectPtr);
@@ -1591,7 +1644,11 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 		env->_effectiveCopyScanCache = copyCache;
 
 		/* Update the stats */
+		if (NULL != env->_heapCensus) {
+			env->_heapCensus->add(_extensions->objectModel.getObjectCensusKey(destinationObjectPtr), objectReserveSizeInBytes);
+		}
 		MM_ScavengerStats *scavStats = &env->_scavengerStats;
+		scavStats->countCopySize(objectCopySizeInBytes);
 		if(copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE) {
 			scavStats->_tenureAggregateCount += 1;
 			scavStats->_tenureAggregateBytes += objectCopySizeInBytes;
@@ -1607,6 +1664,9 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->_flipCount += 1;
 			scavStats->_flipBytes += objectCopySizeInBytes;
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
+			/* objectAge is the post flip age, which selected the stream */
+			scavStats->_survivorAgeStreamFlipCounts[_survivorAgeStream[objectAge]] += 1;
+			scavStats->_survivorAgeStreamFlipBytes[_survivorAgeStream[objectAge]] += objectCopySizeInBytes;
 		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
@@ -1933,10 +1993,12 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	bool doneFlag = false;
 	volatile uintptr_t doneIndex = _doneIndex;
 
-	/* Preference is to use survivor copy cache */
-	cache = env->_survivorCopyScanCache;
-	if (isWorkAvailableInCacheWithCheck(cache)) {
-		return cache;
+	/* Preference is to use survivor copy caches */
+	for (uintptr_t stream = 0; stream < _survivorAgeStreams; stream++) {
+		cache = env->_survivorCopyScanCaches[stream];
+		if (isWorkAvailableInCacheWithCheck(cache)) {
+			return cache;
+		}
 	}
 
 	/* Otherwise the tenure copy cache */
@@ -2019,6 +2081,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					} else {
 						env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
 					}
+					env->_taskPhaseStats.addToIdleTime(waitStartTime, waitEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				}
 			}
@@ -2446,6 +2509,10 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	/* No matter what happens, always sum up the gc stats */
 	mergeThreadGCStats(env);
+
+	if (NULL != _extensions->heapCensusManager) {
+		_extensions->heapCensusManager->threadEnd(env);
+	}
 }
 
 /****************************************
@@ -3196,6 +3263,20 @@ MM_Scavenger::reinitCache(MM_CopyScanCacheStandard *cache, void *base, void *top
 	cache->cacheTop = top;
 }
 
+uintptr_t
+MM_Scavenger::calculateTotalActiveCacheCount(uintptr_t activeNewSpaceSize)
+{
+	uintptr_t totalActiveCacheCount = activeNewSpaceSize / _extensions->scavengerScanCacheMinimumSize;
+
+	/* Each GC thread can hold a copy cache open for every additional survivor age stream. Reserve them up front,
+	 * rather than have getFreeCache() create them in the heap, which may be exhausted (as it is when a scavenge
+	 * backs out).
+	 */
+	totalActiveCacheCount += (_survivorAgeStreams - 1) * _extensions->gcThreadCount;
+
+	return OMR_MAX(totalActiveCacheCount, 1);
+}
+
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getFreeCache(MM_EnvironmentStandard *env)
 {
@@ -3491,10 +3572,12 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 	/* Should be already handled at this point */
 	Assert_MM_true(NULL == env->_deferredScanCache);
 
-	if(NULL != env->_survivorCopyScanCache) {
-		env->_survivorCopyScanCache->flags &= ~OMR_SCAVENGER_CACHE_TYPE_COPY;
-		flushCache(env, env->_survivorCopyScanCache);
-		env->_survivorCopyScanCache = NULL;
+	for (uintptr_t stream = 0; stream < _survivorAgeStreams; stream++) {
+		if(NULL != env->_survivorCopyScanCaches[stream]) {
+			env->_survivorCopyScanCaches[stream]->flags &= ~OMR_SCAVENGER_CACHE_TYPE_COPY;
+			flushCache(env, env->_survivorCopyScanCaches[stream]);
+			env->_survivorCopyScanCaches[stream] = NULL;
+		}
 	}
 	if(NULL != env->_deferredCopyCache) {
 		env->_deferredCopyCache->flags &= ~OMR_SCAVENGER_CACHE_TYPE_COPY;
@@ -4193,6 +4276,11 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
+		if (NULL != _extensions->heapCensusManager) {
+			/* a backed out scavenge has not copied every live object */
+			_extensions->heapCensusManager->cycleEnd(env, OMR_GC_CYCLE_TYPE_SCAVENGE, !isBackOutFlagRaised());
+		}
+
 		/* defer to collector language interface */
 		_cli->scavenger_masterThreadGarbageCollect_scavengeComplete(env);
 
@@ -4421,7 +4509,7 @@ MM_Scavenger::collectorExpanded(MM_EnvironmentBase *env, MM_MemorySubSpace *subS
 		env->_scavengerStats._tenureExpandedBytes += expandSize;
 		env->_scavengerStats._tenureExpandedTime += resizeStats->getLastExpandTime();
 
-		uintptr_t totalActiveCacheCount = _extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW) / _extensions->scavengerScanCacheMinimumSize;
+		uintptr_t totalActiveCacheCount = calculateTotalActiveCacheCount(_extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW));
 
 		/* TODO: can fail? */
 		_scavengeCacheFreeList.resizeCacheEntries(env, totalActiveCacheCount, 0);
@@ -4911,6 +4999,31 @@ MM_Scavenger::calculateTenureMask()
 	return newMask;
 }
 
+void
+MM_Scavenger::calculateSurvivorAgeStreams()
+{
+	calculateSurvivorAgeStreams(_tenureMask, _survivorAgeStreams, _survivorAgeStream);
+}
+
+void
+MM_Scavenger::calculateSurvivorAgeStreams(uintptr_t tenureMask, uintptr_t streamCount, uintptr_t *ageStreams)
+{
+	/* OBJECT_HEADER_AGE_MAX is always tenured, so every age has a next tenure age */
+	Assert_MM_true(0 != (tenureMask & ((uintptr_t)1 << OBJECT_HEADER_AGE_MAX)));
+	Assert_MM_true(0 < streamCount);
+
+	uintptr_t scavengesToTenure = 0;
+	for (intptr_t age = OBJECT_HEADER_AGE_MAX; age >= 0; age--) {
+		if (0 != (tenureMask & ((uintptr_t)1 << age))) {
+			scavengesToTenure = 0;
+		} else {
+			scavengesToTenure += 1;
+		}
+		/* the last stream collects every survivor that is further from tenure than the others */
+		ageStreams[age] = OMR_MIN(scavengesToTenure, streamCount - 1);
+	}
+}
+
 uintptr_t
 MM_Scavenger::calculateTenureMaskUsingLookback(double minimumSurvivalRate)
 {
@@ -5152,7 +5265,9 @@ MM_Scavenger::mutatorSetupForGC(MM_EnvironmentBase *envBase)
 
 	if (isConcurrentInProgress()) {
 		/* caches should all be reset */
-		Assert_MM_true(NULL == env->_survivorCopyScanCache);
+		for (uintptr_t stream = 0; stream < SCAVENGER_SURVIVOR_AGE_STREAMS_MAX; stream++) {
+			Assert_MM_true(NULL == env->_survivorCopyScanCaches[stream]);
+		}
 		Assert_MM_true(NULL == env->_tenureCopyScanCache);
 		Assert_MM_true(NULL == env->_deferredScanCache);
 		Assert_MM_true(NULL == env->_deferredCopyCache);
@@ -5175,15 +5290,18 @@ MM_Scavenger::threadFinalReleaseCopyCaches(MM_EnvironmentBase *envBase, MM_Envir
 
 		Assert_MM_true(NULL == threadEnvironment->_deferredScanCache);
 
-		if (threadEnvironment->_survivorCopyScanCache) {
-			Assert_MM_true(threadEnvironment->_survivorCopyScanCache->flags & OMR_SCAVENGER_CACHE_TYPE_COPY);
-			threadEnvironment->_survivorCopyScanCache->flags &= ~OMR_SCAVENGER_CACHE_TYPE_COPY;
+		for (uintptr_t stream = 0; stream < _survivorAgeStreams; stream++) {
+			MM_CopyScanCacheStandard *survivorCopyScanCache = threadEnvironment->_survivorCopyScanCaches[stream];
+			if (survivorCopyScanCache) {
+				Assert_MM_true(survivorCopyScanCache->flags & OMR_SCAVENGER_CACHE_TYPE_COPY);
+				survivorCopyScanCache->flags &= ~OMR_SCAVENGER_CACHE_TYPE_COPY;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-			env->_scavengerStats._releaseScanListCount += 1;
+				env->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-			clearCache(env, threadEnvironment->_survivorCopyScanCache);
-			addCacheEntryToScanListAndNotify(env, threadEnvironment->_survivorCopyScanCache);
-			threadEnvironment->_survivorCopyScanCache = NULL;
+				clearCache(env, survivorCopyScanCache);
+				addCacheEntryToScanListAndNotify(env, survivorCopyScanCache);
+				threadEnvironment->_survivorCopyScanCaches[stream] = NULL;
+			}
 		}
 		if (threadEnvironment->_deferredCopyCache) {
 			Assert_MM_true(threadEnvironment->_deferredCopyCache->flags & OMR_SCAVENGER_CACHE_TYPE_CLEARED);
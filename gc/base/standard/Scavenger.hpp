@@ -30,6 +30,7 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "omrcomp.h"
+#include "AdaptiveThreadCount.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
@@ -64,6 +65,8 @@ struct OMR_VM;
 
 #if defined(OMR_GC_EXPERIMENTAL_OBJECT_SCANNER)
 
+namespace OMR { namespace GC { class RefSlotHandle; } }
+
 class MM_Scavenger;
 class MM_CopyScanCache;
 
@@ -102,6 +105,9 @@ public:
 	template <class SlotHandleT>
 	bool edge(void* object, SlotHandleT slot) noexcept;
 
+	/* Out of line, so that root sets compiled outside the collector can report full width root slots */
+	bool edge(void* object, OMR::GC::RefSlotHandle slot) noexcept;
+
 	MM_EnvironmentStandard *_env;
 	MM_Scavenger *_scavenger;
 	int _hasReferentsInNewSpace;
@@ -146,6 +152,7 @@ private:
 	MM_GCExtensionsBase *_extensions;
 	
 	MM_Dispatcher *_dispatcher;
+	MM_AdaptiveThreadCount _adaptiveThreadCount; /**< thread count for the next scavenge task, from the bytes copied by the last one */
 
 	volatile uintptr_t _doneIndex; /**< sequence ID of completeScan loop, which we may have a few during one GC cycle */
 
@@ -158,6 +165,8 @@ private:
 	void *_survivorSpaceBase, *_survivorSpaceTop;	/**< cached base and top heap pointers within survivor subspace */
 
 	uintptr_t _tenureMask; /**< A bit mask indicating which generations should be tenured on scavenge. */
+	uintptr_t _survivorAgeStreams; /**< number of survivor copy cache streams in use (see MM_GCExtensionsBase::scavengerSurvivorAgeStreams) */
+	uintptr_t _survivorAgeStream[OBJECT_HEADER_AGE_MAX + 1]; /**< survivor copy cache stream for each (post flip) object age, recalculated with _tenureMask */
 	bool _expandFailed;
 	bool _failedTenureThresholdReached;
 	uintptr_t _failedTenureLargestObject;
@@ -269,7 +278,25 @@ public:
 	uintptr_t calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t waitingThreads);
 	uintptr_t calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t scanCacheCount);
 	MMINLINE uintptr_t calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env);
-	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
+
+	/**
+	 * Number of copy scan cache entries to keep allocated for a nursery of the given size, including a survivor
+	 * copy cache for each additional survivor age stream of every GC thread.
+	 * @param activeNewSpaceSize active size of the nursery, in bytes
+	 */
+	uintptr_t calculateTotalActiveCacheCount(uintptr_t activeNewSpaceSize);
+	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes, uintptr_t survivorAgeStream);
+
+	/**
+	 * Get the survivor copy cache stream for an object about to be flipped.
+	 * @param objectAge the age of the object before the flip increments it
+	 * @return index into MM_EnvironmentStandard::_survivorCopyScanCaches
+	 */
+	MMINLINE uintptr_t
+	getSurvivorAgeStream(uintptr_t objectAge)
+	{
+		return _survivorAgeStream[OMR_MIN(objectAge + 1, (uintptr_t)OBJECT_HEADER_AGE_MAX)];
+	}
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
 	/**
@@ -656,6 +683,22 @@ public:
 	 */
 	uintptr_t calculateTenureMask();
 
+	/**
+	 * Map each object age to the survivor copy cache stream that objects of that age are flipped into.
+	 * Survivors are grouped by the number of scavenges left before _tenureMask tenures them, so objects
+	 * that will tenure together are copied next to each other. Must be called after _tenureMask is set.
+	 */
+	void calculateSurvivorAgeStreams();
+
+	/**
+	 * Map each object age to a survivor copy cache stream: the number of scavenges before tenureMask tenures
+	 * an object of that age, capped at the last stream.
+	 * @param tenureMask mask of ages to tenure, which must include OBJECT_HEADER_AGE_MAX
+	 * @param streamCount number of survivor age streams, at least 1
+	 * @param[out] ageStreams stream for each age, OBJECT_HEADER_AGE_MAX + 1 entries
+	 */
+	static void calculateSurvivorAgeStreams(uintptr_t tenureMask, uintptr_t streamCount, uintptr_t *ageStreams);
+
 	/**
 	 * reset LargeAllocateStats in Tenure Space
 	 * @param env Master GC thread.
@@ -917,6 +960,7 @@ public:
 		, _isRememberedSetInOverflowAtTheBeginning(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
+		, _adaptiveThreadCount()
 		, _doneIndex(0)
 		, _activeSubSpace(NULL)
 		, _evacuateMemorySubSpace(NULL)
@@ -927,6 +971,7 @@ public:
 		, _survivorSpaceBase(NULL)
 		, _survivorSpaceTop(NULL)
 		, _tenureMask(0)
+		, _survivorAgeStreams(1)
 		, _expandFailed(false)
 		, _failedTenureThresholdReached(false)
 		, _countSinceForcingGlobalGC(0)
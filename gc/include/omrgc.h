@@ -42,6 +42,26 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Called for every object in the heap. Calls are made on GC threads, concurrently for objects in different parts of the heap */
+typedef void (*OMR_GC_HeapWalkFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, void *userData);
+
+/* Walk all objects in the heap in parallel with exclusive VM access. Returns OMR_ERROR_NOT_AVAILABLE if the GC policy does not support walking */
+omr_error_t OMR_GC_WalkHeap(OMR_VMThread* omrVMThread, OMR_GC_HeapWalkFunction function, void *userData);
+
+/* One object reported by OMR_GC_AnalyzeRetainedSizes */
+typedef struct OMR_GC_RetainedSize {
+	omrobjectptr_t object;
+	omrobjectptr_t dominator; /* immediate dominator, NULL if the object is only dominated by the roots */
+	uintptr_t shallowSize; /* bytes consumed by the object itself */
+	uintptr_t retainedSize; /* bytes that would be freed if the object became unreachable */
+} OMR_GC_RetainedSize;
+
+/* Compute the dominator tree of the live heap with exclusive VM access and report the *resultCount objects with the largest
+ * retained sizes, largest first. roots are the objects the caller considers GC roots; live objects not reachable from them
+ * are treated as roots too. On return *resultCount holds the number of entries filled in. Returns OMR_ERROR_NOT_AVAILABLE
+ * if the GC policy does not support the analysis or the heap has too many objects */
+omr_error_t OMR_GC_AnalyzeRetainedSizes(OMR_VMThread* omrVMThread, omrobjectptr_t *roots, uintptr_t rootCount, OMR_GC_RetainedSize *results, uintptr_t *resultCount);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
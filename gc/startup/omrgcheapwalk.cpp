@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrgc.h"
+#include "objectdescription.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "omrgcstartup.hpp"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "DominatorAnalysis.hpp"
+#include "HeapWalker.hpp"
+#include "MarkingScheme.hpp"
+#include "OMRVMInterface.hpp"
+#include "ParallelGlobalGC.hpp"
+#endif /* OMR_GC_MODRON_STANDARD */
+
+#if defined(OMR_GC_MODRON_STANDARD)
+typedef struct OMR_GC_HeapWalkData {
+	OMR_GC_HeapWalkFunction function;
+	void *userData;
+} OMR_GC_HeapWalkData;
+
+static void
+heapWalkObjectDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	OMR_GC_HeapWalkData *walkData = (OMR_GC_HeapWalkData *)userData;
+	walkData->function(omrVMThread, object, walkData->userData);
+}
+#endif /* OMR_GC_MODRON_STANDARD */
+
+omr_error_t
+OMR_GC_WalkHeap(OMR_VMThread* omrVMThread, OMR_GC_HeapWalkFunction function, void *userData)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (NULL == extensions->getGlobalCollector()) {
+		result = OMR_GC_InitializeCollector(omrVMThread);
+	}
+	if (OMR_ERROR_NONE == result) {
+#if defined(OMR_GC_MODRON_STANDARD)
+		if (extensions->isStandardGC()) {
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+			OMR_GC_HeapWalkData walkData = { function, userData };
+
+			env->acquireExclusiveVMAccess();
+			globalCollector->completeExternalConcurrentCycle(env);
+			/* the walk marks the heap first, so the mark map can split every region into chunks for the GC threads */
+			globalCollector->getHeapWalker()->allObjectsDo(env, heapWalkObjectDo, (void *)&walkData, MEMORY_TYPE_RAM, true, true);
+			/* the mark map goes stale as soon as objects move or are allocated, so later walks may not split regions at it */
+			globalCollector->getMarkingScheme()->getMarkMap()->setMarkMapValid(false);
+			env->releaseExclusiveVMAccess();
+		} else
+#endif /* OMR_GC_MODRON_STANDARD */
+		{
+			result = OMR_ERROR_NOT_AVAILABLE;
+		}
+	}
+	return result;
+}
+
+omr_error_t
+OMR_GC_AnalyzeRetainedSizes(OMR_VMThread* omrVMThread, omrobjectptr_t *roots, uintptr_t rootCount, OMR_GC_RetainedSize *results, uintptr_t *resultCount)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (NULL == extensions->getGlobalCollector()) {
+		result = OMR_GC_InitializeCollector(omrVMThread);
+	}
+	if (OMR_ERROR_NONE == result) {
+#if defined(OMR_GC_MODRON_STANDARD)
+		if (extensions->isStandardGC()) {
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+			MM_DominatorAnalysis *analysis = MM_DominatorAnalysis::newInstance(env);
+			if (NULL == analysis) {
+				result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+			} else {
+				env->acquireExclusiveVMAccess();
+				globalCollector->completeExternalConcurrentCycle(env);
+				/* the analysis numbers live objects by their mark bits, so the heap has to be freshly marked */
+				GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+				globalCollector->prepareHeapForWalk(env);
+				result = analysis->analyze(env, globalCollector->getMarkingScheme()->getMarkMap(), roots, rootCount, results, resultCount);
+				/* as after a heap walk, later walks may not split regions at this mark map */
+				globalCollector->getMarkingScheme()->getMarkMap()->setMarkMapValid(false);
+				env->releaseExclusiveVMAccess();
+				analysis->kill(env);
+			}
+		} else
+#endif /* OMR_GC_MODRON_STANDARD */
+		{
+			result = OMR_ERROR_NOT_AVAILABLE;
+		}
+	}
+	if (OMR_ERROR_NONE != result) {
+		*resultCount = 0;
+	}
+	return result;
+}
@@ -44,6 +44,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "TLHPreZeroingService.hpp"
 #include "VerboseManager.hpp"
 
 /* ****************
@@ -223,6 +224,13 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 		rc = OMR_ERROR_INTERNAL;
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if ((OMR_ERROR_NONE == rc) && extensions->tlhPreZeroing && (0 != extensions->batchClearTLH)) {
+		/* Best effort: without the service every batch cleared TLH is zeroed as it is handed out */
+		extensions->tlhPreZeroingService = MM_TLHPreZeroingService::newInstance(MM_EnvironmentBase::getEnvironment(omrVMThread));
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	return rc;
 }
 
@@ -232,6 +240,13 @@ OMR_GC_ShutdownDispatcherThreads(OMR_VMThread* omrVMThread)
 	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
 	omr_error_t rc = OMR_ERROR_NONE;
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != extensions->tlhPreZeroingService) {
+		extensions->tlhPreZeroingService->kill(MM_EnvironmentBase::getEnvironment(omrVMThread));
+		extensions->tlhPreZeroingService = NULL;
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	if (NULL != extensions->dispatcher) {
 		extensions->dispatcher->shutDownThreads();
 		extensions->dispatcher->kill(MM_EnvironmentBase::getEnvironment(omrVMThread));
@@ -29,11 +29,13 @@ MM_AllocationStats::clear()
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	_tlhRefreshCountFresh = 0;
 	_tlhRefreshCountReused = 0;
+	_tlhRefreshCountPreZeroed = 0;
 	_tlhAllocatedFresh = 0;
 	_tlhAllocatedReused = 0;
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhAbandonedBytes = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -55,10 +57,12 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	MM_AtomicOperations::add(&_tlhRefreshCountFresh, stats->_tlhRefreshCountFresh);
 	MM_AtomicOperations::add(&_tlhRefreshCountReused, stats->_tlhRefreshCountReused);
+	MM_AtomicOperations::add(&_tlhRefreshCountPreZeroed, stats->_tlhRefreshCountPreZeroed);
 	MM_AtomicOperations::add(&_tlhAllocatedFresh, stats->_tlhAllocatedFresh);
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhAbandonedBytes, stats->_tlhAbandonedBytes);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
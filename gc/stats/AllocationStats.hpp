@@ -36,11 +36,13 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 	uintptr_t _tlhRefreshCountFresh; /**< Number of refreshes where fresh memory was allocated. */
 	uintptr_t _tlhRefreshCountReused; /**< Number of refreshes where TLHs were reused. */
+	uintptr_t _tlhRefreshCountPreZeroed; /**< Number of fresh refreshes served by a TLH the pre-zeroing service had already zeroed. */
 	uintptr_t _tlhAllocatedFresh; /**< The amount of memory allocated fresh out of the heap. */
 	uintptr_t _tlhAllocatedReused; /**< The amount of memory allocated form reused TLHs. */
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhAbandonedBytes; /**< The amount of unused TLH memory given back to the heap when TLHs were cleared or flushed. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -83,11 +85,13 @@ public:
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 		_tlhRefreshCountFresh(0),
 		_tlhRefreshCountReused(0),
+		_tlhRefreshCountPreZeroed(0),
 		_tlhAllocatedFresh(0),
 		_tlhAllocatedReused(0),
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhAbandonedBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
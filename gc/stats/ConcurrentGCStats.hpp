@@ -67,6 +67,9 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uintptr_t _assistPaymentCount; /**< paced allocation taxes paid by tracing */
+	volatile uintptr_t _assistDeferredCount; /**< paced allocation taxes left to the helper threads */
+	volatile uintptr_t _assistInstallmentCount; /**< paced allocation taxes paid for less than the debt of the mutator */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -201,6 +204,13 @@ public:
 	MMINLINE uintptr_t getThreadsToScanCount() { return _threadsToScanCount; };
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
+
+	MMINLINE void incAssistPaymentCount() { incrementCount((uintptr_t *)&_assistPaymentCount, 1); };
+	MMINLINE uintptr_t getAssistPaymentCount() { return _assistPaymentCount; };
+	MMINLINE void incAssistDeferredCount() { incrementCount((uintptr_t *)&_assistDeferredCount, 1); };
+	MMINLINE uintptr_t getAssistDeferredCount() { return _assistDeferredCount; };
+	MMINLINE void incAssistInstallmentCount() { incrementCount((uintptr_t *)&_assistInstallmentCount, 1); };
+	MMINLINE uintptr_t getAssistInstallmentCount() { return _assistInstallmentCount; };
 	
 	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
@@ -227,6 +237,9 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		clearCount((uintptr_t *)&_assistPaymentCount);
+		clearCount((uintptr_t *)&_assistDeferredCount);
+		clearCount((uintptr_t *)&_assistInstallmentCount);
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,6 +273,9 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_assistPaymentCount(0),
+		_assistDeferredCount(0),
+		_assistInstallmentCount(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
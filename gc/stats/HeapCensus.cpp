@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include <string.h>
+
+#include "HeapCensus.hpp"
+
+void
+MM_HeapCensus::clear()
+{
+	memset(_entries, 0, sizeof(_entries));
+	_typeCount = 0;
+	_objects = 0;
+	_bytes = 0;
+	_unrecordedObjects = 0;
+	_unrecordedBytes = 0;
+}
+
+void
+MM_HeapCensus::merge(MM_HeapCensus *censusToMerge)
+{
+	if (0 != censusToMerge->_objects) {
+		for (uintptr_t index = 0; index < HEAP_CENSUS_TABLE_SIZE; index++) {
+			MM_HeapCensusEntry *entry = &censusToMerge->_entries[index];
+			if (0 != entry->objects) {
+				record(entry->key, entry->objects, entry->bytes);
+			}
+		}
+		_objects += censusToMerge->_objects;
+		_bytes += censusToMerge->_bytes;
+		_unrecordedObjects += censusToMerge->_unrecordedObjects;
+		_unrecordedBytes += censusToMerge->_unrecordedBytes;
+	}
+}
+
+uintptr_t
+MM_HeapCensus::getLargestTypes(MM_HeapCensusEntry *entries, uintptr_t maxEntries)
+{
+	uintptr_t count = 0;
+	for (uintptr_t index = 0; index < HEAP_CENSUS_TABLE_SIZE; index++) {
+		MM_HeapCensusEntry *entry = &_entries[index];
+		if ((0 != entry->objects) && ((count < maxEntries) || (entry->bytes > entries[maxEntries - 1].bytes))) {
+			/* insertion into the sorted prefix, dropping the smallest once it is full */
+			uintptr_t position = (count < maxEntries) ? count++ : (maxEntries - 1);
+			while ((0 < position) && (entries[position - 1].bytes < entry->bytes)) {
+				entries[position] = entries[position - 1];
+				position -= 1;
+			}
+			entries[position] = *entry;
+		}
+	}
+	return count;
+}
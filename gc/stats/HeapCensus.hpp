@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(HEAPCENSUS_HPP_)
+#define HEAPCENSUS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+#define HEAP_CENSUS_TABLE_SHIFT 9
+#define HEAP_CENSUS_TABLE_SIZE ((uintptr_t)1 << HEAP_CENSUS_TABLE_SHIFT)
+#define HEAP_CENSUS_TABLE_LIMIT ((HEAP_CENSUS_TABLE_SIZE * 3) / 4)
+
+/**
+ * Number and size of the counted objects of one type.
+ * @ingroup GC_Stats
+ */
+typedef struct MM_HeapCensusEntry {
+	uintptr_t key; /**< the object type, as returned by GC_ObjectModel::getObjectCensusKey() */
+	uintptr_t objects; /**< number of objects of this type, 0 if the entry is unused */
+	uintptr_t bytes; /**< consumed heap bytes of these objects */
+} MM_HeapCensusEntry;
+
+/**
+ * Per type object counts (a class histogram) collected while a collector visits objects: marked objects
+ * in a global collection, copied objects in a scavenge.
+ *
+ * Counts are kept in an open addressing table with linear probing, so recording an object costs a hash and,
+ * usually, one probe.  Each GC thread counts into its own table, which is merged into the census of the
+ * cycle when the thread finishes.  The table never grows: objects of types that do not fit below the load
+ * limit are only counted in the unrecorded totals.
+ * @ingroup GC_Stats
+ */
+class MM_HeapCensus : public MM_Base
+{
+/* data members */
+private:
+	MM_HeapCensusEntry _entries[HEAP_CENSUS_TABLE_SIZE];
+	uintptr_t _typeCount; /**< number of used entries */
+
+protected:
+public:
+	uintptr_t _objects; /**< number of counted objects, including unrecorded ones */
+	uintptr_t _bytes; /**< consumed heap bytes of the counted objects, including unrecorded ones */
+	uintptr_t _unrecordedObjects; /**< number of counted objects whose type did not fit in the table */
+	uintptr_t _unrecordedBytes; /**< consumed heap bytes of the unrecorded objects */
+
+/* function members */
+private:
+	MMINLINE static uintptr_t
+	hashKey(uintptr_t key)
+	{
+		/* Fibonacci hashing: keys are often aligned pointers or sizes, so fold the high bits in and keep the top of the product */
+		uint32_t folded = (uint32_t)(key ^ (key >> 16));
+		return (uintptr_t)((folded * (uint32_t)2654435769U) >> (32 - HEAP_CENSUS_TABLE_SHIFT));
+	}
+
+	MMINLINE void
+	record(uintptr_t key, uintptr_t objects, uintptr_t bytes)
+	{
+		uintptr_t index = hashKey(key);
+		while (true) {
+			MM_HeapCensusEntry *entry = &_entries[index];
+			if (0 == entry->objects) {
+				if (_typeCount < HEAP_CENSUS_TABLE_LIMIT) {
+					entry->key = key;
+					entry->objects = objects;
+					entry->bytes = bytes;
+					_typeCount += 1;
+				} else {
+					_unrecordedObjects += objects;
+					_unrecordedBytes += bytes;
+				}
+				break;
+			}
+			if (key == entry->key) {
+				entry->objects += objects;
+				entry->bytes += bytes;
+				break;
+			}
+			index = (index + 1) & (HEAP_CENSUS_TABLE_SIZE - 1);
+		}
+	}
+
+protected:
+public:
+	/**
+	 * Count one object.
+	 * @param key the type of the object
+	 * @param bytes consumed heap bytes of the object
+	 */
+	MMINLINE void
+	add(uintptr_t key, uintptr_t bytes)
+	{
+		_objects += 1;
+		_bytes += bytes;
+		record(key, 1, bytes);
+	}
+
+	/**
+	 * @return number of object types in the table
+	 */
+	MMINLINE uintptr_t getTypeCount() { return _typeCount; }
+
+	void clear();
+	void merge(MM_HeapCensus *censusToMerge);
+
+	/**
+	 * Copy the types with the most bytes out of the table, largest first.
+	 * @param[out] entries receives at most maxEntries entries
+	 * @param[in] maxEntries size of entries
+	 * @return the number of entries copied
+	 */
+	uintptr_t getLargestTypes(MM_HeapCensusEntry *entries, uintptr_t maxEntries);
+
+	MM_HeapCensus() :
+		MM_Base()
+		,_typeCount(0)
+		,_objects(0)
+		,_bytes(0)
+		,_unrecordedObjects(0)
+		,_unrecordedBytes(0)
+	{
+		clear();
+	}
+};
+
+#endif /* HEAPCENSUS_HPP_ */
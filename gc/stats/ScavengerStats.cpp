@@ -85,6 +85,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_nonTemporalCopyCount(0)
+	,_nonTemporalCopyBytes(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -96,6 +98,10 @@ MM_ScavengerStats::MM_ScavengerStats()
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_copy_size_bytes, 0, sizeof(_copy_size_bytes));
+	memset(_copy_size_counts, 0, sizeof(_copy_size_counts));
+	memset(_survivorAgeStreamFlipCounts, 0, sizeof(_survivorAgeStreamFlipCounts));
+	memset(_survivorAgeStreamFlipBytes, 0, sizeof(_survivorAgeStreamFlipBytes));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -194,4 +200,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_copy_size_bytes, 0, sizeof(_copy_size_bytes));
+	memset(_copy_size_counts, 0, sizeof(_copy_size_counts));
+	_nonTemporalCopyCount = 0;
+	_nonTemporalCopyBytes = 0;
+	memset(_survivorAgeStreamFlipCounts, 0, sizeof(_survivorAgeStreamFlipCounts));
+	memset(_survivorAgeStreamFlipBytes, 0, sizeof(_survivorAgeStreamFlipBytes));
 };
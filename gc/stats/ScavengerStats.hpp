@@ -36,9 +36,15 @@ class MM_EnvironmentBase;
 
 #define OMR_SCAVENGER_DISTANCE_BINS 32
 #define OMR_SCAVENGER_CACHESIZE_BINS 16
+/* Copied objects are binned by floor(log2(size)), from [16B, 32B) up to [512KB, infinity) */
+#define OMR_SCAVENGER_COPYSIZE_BINS 16
+#define OMR_SCAVENGER_COPYSIZE_MINIMUM_SHIFT 4
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
+/* The most survivor copy caches a thread keeps open at once, one per age stream. */
+#define SCAVENGER_SURVIVOR_AGE_STREAMS_MAX 4
+
 /**
  * Storage for statistics relevant to a scavenging (semi-space copying) collector.
  * @ingroup GC_Stats
@@ -132,6 +138,12 @@ public:
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
+	uint64_t _copy_size_bytes[OMR_SCAVENGER_COPYSIZE_BINS]; /**< Bytes copied (flipped or tenured), binned by object size */
+	uint64_t _copy_size_counts[OMR_SCAVENGER_COPYSIZE_BINS]; /**< Objects copied (flipped or tenured), binned by object size */
+	uint64_t _nonTemporalCopyCount; /**< Objects copied with non-temporal stores */
+	uint64_t _nonTemporalCopyBytes; /**< Bytes copied with non-temporal stores */
+	uint64_t _survivorAgeStreamFlipCounts[SCAVENGER_SURVIVOR_AGE_STREAMS_MAX]; /**< Objects flipped into each survivor age stream */
+	uint64_t _survivorAgeStreamFlipBytes[SCAVENGER_SURVIVOR_AGE_STREAMS_MAX]; /**< Bytes flipped into each survivor age stream */
 
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
@@ -223,6 +235,18 @@ public:
 		_copy_cachesize_sum += copyCacheSize;
 	}
 
+	MMINLINE void
+	countCopySize(uintptr_t copySizeInBytes)
+	{
+		uintptr_t bin = MM_Math::floorLog2(copySizeInBytes);
+		bin = (OMR_SCAVENGER_COPYSIZE_MINIMUM_SHIFT < bin) ? (bin - OMR_SCAVENGER_COPYSIZE_MINIMUM_SHIFT) : 0;
+		if (OMR_SCAVENGER_COPYSIZE_BINS <= bin) {
+			bin = OMR_SCAVENGER_COPYSIZE_BINS - 1;
+		}
+		_copy_size_bytes[bin] += copySizeInBytes;
+		_copy_size_counts[bin] += 1;
+	}
+
 	void clear(bool firstIncrement);
 	MM_ScavengerStats();
 
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "TaskPhaseStats.hpp"
+
+void
+MM_TaskPhaseStats::clear()
+{
+	_startTime = 0;
+	_threadCount = 0;
+	_dispatchTime = 0;
+	_totalTime = 0;
+	_maxTotalTime = 0;
+	_syncStallTime = 0;
+	_syncStallCount = 0;
+	_idleTime = 0;
+	_idleCount = 0;
+	_completeStallTime = 0;
+	for (uintptr_t i = 0; i < OMR_TASK_PHASE_HISTOGRAM_BINS; i++) {
+		_syncStallHistogram[i] = 0;
+	}
+}
+
+void
+MM_TaskPhaseStats::merge(MM_TaskPhaseStats *statsToMerge)
+{
+	_threadCount += 1;
+	_dispatchTime += statsToMerge->_dispatchTime;
+	_totalTime += statsToMerge->_totalTime;
+	_maxTotalTime = OMR_MAX(_maxTotalTime, statsToMerge->_totalTime);
+	_syncStallTime += statsToMerge->_syncStallTime;
+	_syncStallCount += statsToMerge->_syncStallCount;
+	_idleTime += statsToMerge->_idleTime;
+	_idleCount += statsToMerge->_idleCount;
+	_completeStallTime += statsToMerge->_completeStallTime;
+	for (uintptr_t i = 0; i < OMR_TASK_PHASE_HISTOGRAM_BINS; i++) {
+		_syncStallHistogram[i] += statsToMerge->_syncStallHistogram[i];
+	}
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(TASKPHASESTATS_HPP_)
+#define TASKPHASESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/**
+ * Number of log2 buckets in the sync stall histogram.  Bucket i counts stalls of [2^i, 2^(i+1)) hi-res
+ * ticks; the last bucket also absorbs anything longer.
+ */
+#define OMR_TASK_PHASE_HISTOGRAM_BINS 32
+
+/**
+ * Per thread timing of a single dispatched task (MM_Task).  A GC thread accumulates into the instance
+ * in its environment between accept and complete; the threads then merge into the instance owned by the task,
+ * which is reported to J9HOOK_MM_PRIVATE_TASK_PHASE_END once all threads have completed.
+ *
+ * All times are raw omrtime_hires_clock() deltas, converted to a resolution at the time of output.
+ * @ingroup GC_Stats
+ */
+class MM_TaskPhaseStats : public MM_Base
+{
+/* Data Members */
+public:
+	uint64_t _startTime; /**< Time the thread accepted the task (thread local only) */
+	uintptr_t _threadCount; /**< Number of threads merged into the receiver */
+	uint64_t _dispatchTime; /**< Time between the task being dispatched and the thread accepting it */
+	uint64_t _totalTime; /**< Time between accept and complete */
+	uint64_t _maxTotalTime; /**< Longest per thread _totalTime merged into the receiver */
+	uint64_t _syncStallTime; /**< Time spent blocked in synchronizeGCThreads and its variants */
+	uintptr_t _syncStallCount; /**< Number of sync points reached */
+	uint64_t _idleTime; /**< Time spent waiting for work to be produced by other threads */
+	uintptr_t _idleCount; /**< Number of idle waits */
+	uint64_t _completeStallTime; /**< Time the master spent waiting for the other threads to complete the task */
+	uintptr_t _syncStallHistogram[OMR_TASK_PHASE_HISTOGRAM_BINS]; /**< Distribution of individual sync stall durations */
+
+/* Function Members */
+public:
+	/**
+	 * Reset the statistics to their initial state.
+	 */
+	void clear();
+
+	/**
+	 * Merges the results from the input MM_TaskPhaseStats with the statistics contained within
+	 * the instance.
+	 *
+	 * @param[in] statsToMerge	Task phase statistics
+	 */
+	void merge(MM_TaskPhaseStats *statsToMerge);
+
+	/**
+	 * Record the time spent blocked at a sync point.
+	 * Don't need to worry about wrap (endTime < startTime as unsigned math takes care of wrap)
+	 */
+	MMINLINE void
+	addToSyncStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		uint64_t stallTime = endTime - startTime;
+		_syncStallCount += 1;
+		_syncStallTime += stallTime;
+		_syncStallHistogram[getHistogramBin(stallTime)] += 1;
+	}
+
+	/**
+	 * Record the time spent waiting for other threads to produce work.
+	 */
+	MMINLINE void
+	addToIdleTime(uint64_t startTime, uint64_t endTime)
+	{
+		_idleCount += 1;
+		_idleTime += (endTime - startTime);
+	}
+
+	/**
+	 * Get the time spent doing real work, i.e. task time that was not spent stalled or idle.
+	 * @return the time in hi-res ticks
+	 */
+	MMINLINE uint64_t
+	getWorkTime()
+	{
+		uint64_t nonWorkTime = _syncStallTime + _idleTime + _completeStallTime;
+		return (_totalTime > nonWorkTime) ? (_totalTime - nonWorkTime) : 0;
+	}
+
+	/**
+	 * @return the histogram bucket for a stall of the given number of hi-res ticks
+	 */
+	MMINLINE static uintptr_t
+	getHistogramBin(uint64_t ticks)
+	{
+		uintptr_t bin = 0;
+		while ((ticks > 1) && (bin < (OMR_TASK_PHASE_HISTOGRAM_BINS - 1))) {
+			ticks >>= 1;
+			bin += 1;
+		}
+		return bin;
+	}
+
+	MM_TaskPhaseStats() :
+		MM_Base()
+	{
+		clear();
+	};
+};
+
+#endif /* !TASKPHASESTATS_HPP_ */
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+#include "omrcomp.h"
+
+/**
+ * @file
+ * On-disk layout of the binary verbose GC event stream written by MM_VerboseWriterFileLoggingBinary.
+ *
+ * A stream is a VerboseBinaryFileHeader followed by a sequence of length-prefixed records.  Every
+ * record starts with a VerboseBinaryRecordHeader and is followed by zero or more uint64_t payload
+ * fields whose meaning depends on the record type (see VerboseBinaryRecordType).  All values are
+ * written in the byte order of the producing machine, which is recorded in the file header.
+ *
+ * Records are drained from several per-thread buffers, so they are only ordered by timestamp within
+ * a single thread index.  Readers should sort on the timestamp when a global order is required.
+ * Timestamps are raw hires clock ticks; divide by the hires frequency from the header to get seconds.
+ *
+ * Readers must skip records of unknown type using the length field, and must ignore any payload
+ * fields past the ones they understand, so that new fields can be appended without a version bump.
+ */
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB1"
+#define VERBOSE_BINARY_MAGIC_LENGTH 8
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_BYTE_ORDER_MARK 0x01020304
+
+typedef struct VerboseBinaryFileHeader {
+	char magic[VERBOSE_BINARY_MAGIC_LENGTH]; /**< VERBOSE_BINARY_MAGIC, not NUL terminated */
+	uint32_t version; /**< VERBOSE_BINARY_VERSION of the producer */
+	uint32_t byteOrderMark; /**< VERBOSE_BINARY_BYTE_ORDER_MARK as written by the producer */
+	uint32_t headerSize; /**< sizeof(VerboseBinaryFileHeader) of the producer, records start at this offset */
+	uint32_t threadCount; /**< number of per-thread buffers (upper bound of the record thread index) */
+	uint64_t hiresFrequency; /**< hires clock ticks per second */
+	uint64_t startHiresTime; /**< hires clock when the stream was opened */
+	uint64_t startWallTimeMillis; /**< wall clock (ms since the epoch) when the stream was opened */
+} VerboseBinaryFileHeader;
+
+typedef struct VerboseBinaryRecordHeader {
+	uint32_t length; /**< total record length in bytes, including this header */
+	uint16_t type; /**< a VerboseBinaryRecordType */
+	uint16_t threadIndex; /**< index of the per-thread buffer the record was written to */
+	uint64_t timestamp; /**< hires clock ticks at the time of the event */
+} VerboseBinaryRecordHeader;
+
+/**
+ * Record types and the uint64_t payload fields that follow the record header, in order.
+ * Durations are in hires clock ticks unless stated otherwise.
+ */
+typedef enum VerboseBinaryRecordType {
+	VERBOSE_BINARY_RECORD_NONE = 0,
+	VERBOSE_BINARY_RECORD_EXCLUSIVE_START = 1, /**< exclusiveAccessTime, meanIdleTime, haltedThreads */
+	VERBOSE_BINARY_RECORD_EXCLUSIVE_END = 2, /**< no payload */
+	VERBOSE_BINARY_RECORD_CYCLE_START = 3, /**< cycleType, nurseryFree, nurseryTotal, tenureFree, tenureTotal */
+	VERBOSE_BINARY_RECORD_CYCLE_END = 4, /**< cycleType, nurseryFree, nurseryTotal, tenureFree, tenureTotal, workStackOverflowCount */
+	VERBOSE_BINARY_RECORD_INCREMENT_START = 5, /**< cycleType, totalHeap, freeHeap */
+	VERBOSE_BINARY_RECORD_INCREMENT_END = 6, /**< cycleType, totalHeap, freeHeap, duration, userTimeNs, systemTimeNs */
+	VERBOSE_BINARY_RECORD_MARK_END = 7, /**< duration, objectsMarked, objectsScanned, bytesScanned */
+	VERBOSE_BINARY_RECORD_SWEEP_END = 8, /**< duration */
+	VERBOSE_BINARY_RECORD_SCAVENGE_END = 9, /**< duration, flipCount, flipBytes, tenureCount, tenureBytes, failedFlipCount, failedTenureCount, tenureAge, backout */
+	VERBOSE_BINARY_RECORD_CONCURRENT_KICKOFF = 10, /**< reason, traceTarget, kickoffThreshold, remainingFree */
+	VERBOSE_BINARY_RECORD_CONCURRENT_ABORTED = 11, /**< reason */
+	VERBOSE_BINARY_RECORD_RECORDS_DROPPED = 12, /**< records, bytes -- emitted by the flusher when a thread buffer overflowed */
+	VERBOSE_BINARY_RECORD_TYPE_COUNT
+} VerboseBinaryRecordType;
+
+/**
+ * Largest payload of any record type, in fields.  Writers size their scratch record on this.
+ */
+#define VERBOSE_BINARY_MAX_FIELDS 9
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
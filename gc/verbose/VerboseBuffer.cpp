@@ -124,6 +124,27 @@ MM_VerboseBuffer::add(MM_EnvironmentBase *env, const char *string)
 	return result;
 }
 
+/**
+ * Add a string to the buffer without growing it
+ *
+ * @param string String to add
+ * @return true on success, false if the string does not fit
+ */
+bool
+MM_VerboseBuffer::addIfRoom(const char *string)
+{
+	uintptr_t stringLength = strlen(string);
+
+	/* the NUL byte needs room too */
+	if (freeSpace() <= stringLength) {
+		return false;
+	}
+
+	strcpy(_bufferAlloc, string);
+	_bufferAlloc += stringLength;
+	return true;
+}
+
 bool
 MM_VerboseBuffer::ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded)
 {
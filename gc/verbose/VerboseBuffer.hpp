@@ -91,6 +91,14 @@ public:
 	 * @return true on success, false if the buffer could not be expanded
 	 */
 	bool add(MM_EnvironmentBase *env, const char *string);
+
+	/**
+	 * Append the specified NUL terminated string to the buffer if it fits in the space already allocated.
+	 * Never grows the buffer, so it may be used where allocating is not allowed.
+	 * @param string[in] the string to append
+	 * @return true on success, false if the buffer does not have room for the string
+	 */
+	bool addIfRoom(const char *string);
 	
 	/**
 	 * Format the specified data and append it to the buffer.
@@ -26,6 +26,9 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapCensus.hpp"
+#include "MemoryManager.hpp"
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
@@ -37,6 +40,8 @@
 
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerTaskPhaseEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerHeapCensus(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -61,6 +66,9 @@ MM_VerboseHandlerOutput::MM_VerboseHandlerOutput(MM_GCExtensionsBase *extensions
 	,_mmPrivateHooks(NULL)
 	,_mmOmrHooks(NULL)
 	,_manager(NULL)
+	,_heapPagesSampledCommitted(0)
+	,_heapPagesHugePageBacked(0)
+	,_heapPagesReportsSinceSample(0)
 {};
 
 bool
@@ -94,6 +102,12 @@ MM_VerboseHandlerOutput::enableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, OMR_GET_CALLSITE(), (void *)this);
+	if (_extensions->verboseTaskPhaseTimes) {
+		(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_PHASE_END, verboseHandlerTaskPhaseEnd, OMR_GET_CALLSITE(), (void *)this);
+	}
+	if (_extensions->heapCensusEnabled) {
+		(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_HEAP_CENSUS, verboseHandlerHeapCensus, OMR_GET_CALLSITE(), (void *)this);
+	}
 
 	return ;
 }
@@ -104,6 +118,8 @@ MM_VerboseHandlerOutput::disableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_TASK_PHASE_END, verboseHandlerTaskPhaseEnd, NULL);
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_HEAP_CENSUS, verboseHandlerHeapCensus, NULL);
 
 	return ;
 }
@@ -719,6 +735,33 @@ MM_VerboseHandlerOutput::outputMemoryInfo(MM_EnvironmentBase *env, uintptr_t ind
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::outputHeapPageInfo(MM_EnvironmentBase *env, uintptr_t indent)
+{
+	if (0 != _extensions->heapHugePageSize) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_VerboseWriterChain* writer = _manager->getWriterChain();
+		MM_Heap *heap = _extensions->heap;
+		uintptr_t committed = heap->getActiveMemorySize();
+		uintptr_t hugePageBacked = 0;
+		if (heap->getPageSize() >= _extensions->heapHugePageSize) {
+			/* explicit large pages back the whole reservation */
+			hugePageBacked = committed;
+		} else if (heap->getPageSize() == omrvmem_supported_page_sizes()[0]) {
+			/* only walk /proc/self/smaps again once the heap has been resized or the sample is stale */
+			if ((committed != _heapPagesSampledCommitted) || (_heapPagesReportsSinceSample >= VERBOSE_HEAP_PAGES_SAMPLE_INTERVAL)) {
+				_heapPagesHugePageBacked = _extensions->memoryManager->getTransparentHugePageBackedSize(env, heap->getHeapBase(), heap->getHeapTop());
+				_heapPagesSampledCommitted = committed;
+				_heapPagesReportsSinceSample = 0;
+			}
+			_heapPagesReportsSinceSample += 1;
+			hugePageBacked = OMR_MIN(committed, _heapPagesHugePageBacked);
+		}
+		writer->formatAndOutput(env, indent, "<heap-pages alignment=\"%zu\" pageSize=\"%zu\" committed=\"%zu\" hugePageBacked=\"%zu\" />",
+				_extensions->heapAlignment, heap->getPageSize(), committed, hugePageBacked);
+	}
+}
+
 bool
 MM_VerboseHandlerOutput::hasOutputMemoryInfoInnerStanza()
 {
@@ -750,6 +793,11 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		writer->formatAndOutput(env, 1, "<tlh-stats refreshes=\"%zu\" requested=\"%zu\" abandoned=\"%zu\" prezeroed=\"%zu\" />",
+				systemStats->_tlhRefreshCountFresh + systemStats->_tlhRefreshCountReused, systemStats->_tlhRequestedBytes, systemStats->_tlhAbandonedBytes,
+				systemStats->_tlhRefreshCountPreZeroed);
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -830,6 +878,7 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	outputHeapPageInfo(env, _manager->getIndentLevel() + 1);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
@@ -958,6 +1007,69 @@ MM_VerboseHandlerOutput::outputCollectorHeapResizeInfo(MM_EnvironmentBase *env,
 	writer->formatAndOutput(env, indent, "<heap-resize type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" />", resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString);
 }
 
+void
+MM_VerboseHandlerOutput::handleTaskPhaseEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_TaskPhaseEndEvent *event = (MM_TaskPhaseEndEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_TaskPhaseStats *stats = event->phaseStats;
+	MM_VerboseWriterChain *writer = _manager->getWriterChain();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t indent = _manager->getIndentLevel();
+
+	uint64_t dispatchTime = omrtime_hires_delta(0, stats->_dispatchTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t totalTime = omrtime_hires_delta(0, stats->_totalTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t maxTotalTime = omrtime_hires_delta(0, stats->_maxTotalTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t workTime = omrtime_hires_delta(0, stats->getWorkTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t syncStallTime = omrtime_hires_delta(0, stats->_syncStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t idleTime = omrtime_hires_delta(0, stats->_idleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t completeStallTime = omrtime_hires_delta(0, stats->_completeStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, indent, "<task-phase-times type=\"%s\" threads=\"%zu\" dispatchms=\"%llu.%03llu\" totalms=\"%llu.%03llu\" maxthreadms=\"%llu.%03llu\">",
+		event->taskType, stats->_threadCount,
+		dispatchTime / 1000, dispatchTime % 1000,
+		totalTime / 1000, totalTime % 1000,
+		maxTotalTime / 1000, maxTotalTime % 1000);
+	writer->formatAndOutput(env, indent + 1, "<time-breakdown workms=\"%llu.%03llu\" syncms=\"%llu.%03llu\" syncs=\"%zu\" idlems=\"%llu.%03llu\" idles=\"%zu\" completems=\"%llu.%03llu\" />",
+		workTime / 1000, workTime % 1000,
+		syncStallTime / 1000, syncStallTime % 1000, stats->_syncStallCount,
+		idleTime / 1000, idleTime % 1000, stats->_idleCount,
+		completeStallTime / 1000, completeStallTime % 1000);
+	for (uintptr_t bin = 0; bin < OMR_TASK_PHASE_HISTOGRAM_BINS; bin++) {
+		if (0 != stats->_syncStallHistogram[bin]) {
+			/* bins are log2 of hi-res ticks; report the exclusive upper bound of each one in microseconds */
+			uint64_t limit = omrtime_hires_delta(0, ((uint64_t)2) << bin, OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+			writer->formatAndOutput(env, indent + 1, "<sync-stall maxus=\"%llu.%03llu\" count=\"%zu\" />", limit / 1000, limit % 1000, stats->_syncStallHistogram[bin]);
+		}
+	}
+	writer->formatAndOutput(env, indent, "</task-phase-times>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutput::handleHeapCensus(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapCensusEvent *event = (MM_HeapCensusEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_HeapCensus *census = (MM_HeapCensus *)event->census;
+	MM_VerboseWriterChain *writer = _manager->getWriterChain();
+	uintptr_t indent = _manager->getIndentLevel();
+	MM_HeapCensusEntry largest[VERBOSE_HEAP_CENSUS_TYPES];
+	uintptr_t largestCount = census->getLargestTypes(largest, VERBOSE_HEAP_CENSUS_TYPES);
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, indent, "<heap-census type=\"%s\" objects=\"%zu\" bytes=\"%zu\" types=\"%zu\" unrecordedObjects=\"%zu\" unrecordedBytes=\"%zu\">",
+		getCycleType(event->cycleType), event->objects, event->bytes, census->getTypeCount(), census->_unrecordedObjects, census->_unrecordedBytes);
+	for (uintptr_t index = 0; index < largestCount; index++) {
+		writer->formatAndOutput(env, indent + 1, "<census-type key=\"%zu\" objects=\"%zu\" bytes=\"%zu\" />", largest[index].key, largest[index].objects, largest[index].bytes);
+	}
+	writer->formatAndOutput(env, indent, "</heap-census>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 const char *
 MM_VerboseHandlerOutput::getSubSpaceType(uintptr_t typeFlags)
 {
@@ -1018,3 +1130,15 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 {
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerTaskPhaseEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleTaskPhaseEnd(hook, eventNum, eventData);
+}
+
+void
+verboseHandlerHeapCensus(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleHeapCensus(hook, eventNum, eventData);
+}
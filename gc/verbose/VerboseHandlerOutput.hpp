@@ -30,6 +30,9 @@
 
 #include "modronbase.h"
 
+#define VERBOSE_HEAP_CENSUS_TYPES 16 /**< number of object types listed in a heap census stanza */
+#define VERBOSE_HEAP_PAGES_SAMPLE_INTERVAL 16 /**< number of heap-pages stanzas reported from a cached huge page sample while the heap is not resized */
+
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -44,6 +47,9 @@ protected:
 	J9HookInterface** _mmPrivateHooks;  /**< Pointers to the internal Hook interface */
 	J9HookInterface** _mmOmrHooks;  /**< Pointers to the internal Hook interface */
 	MM_VerboseManager *_manager; /* VerboseManager used to format and print output */
+	uintptr_t _heapPagesSampledCommitted; /**< committed heap size when the huge page backed size was last sampled */
+	uintptr_t _heapPagesHugePageBacked; /**< huge page backed size of the heap at the last sample */
+	uintptr_t _heapPagesReportsSinceSample; /**< heap-pages stanzas reported since the last sample */
 public:
 
 private:
@@ -196,6 +202,16 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Output a stand-alone stanza on how much of the committed heap is backed by huge pages.
+	 * Only reported when a huge page size was requested for the heap.
+	 * Transparent huge page coverage is expensive to read, so it is only re-sampled when the
+	 * committed heap size changes or every VERBOSE_HEAP_PAGES_SAMPLE_INTERVAL reports.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputHeapPageInfo(MM_EnvironmentBase *env, uintptr_t indent);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
@@ -462,6 +478,23 @@ public:
 
 	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza for the per task phase timings, enabled by -Xgc:verboseTaskPhaseTimes.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleTaskPhaseEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write the verbose stanza for a heap census, enabled by heapCensusEnabled: the totals and the
+	 * VERBOSE_HEAP_CENSUS_TYPES object types with the most bytes.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleHeapCensus(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the excessive gc raised event.
 	 * @param hook Hook interface used by the JVM.
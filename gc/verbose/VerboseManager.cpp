@@ -34,6 +34,8 @@
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -144,8 +146,8 @@ void
 MM_VerboseManager::enableVerboseGC()
 {
 	if (!_hooksAttached) {
-		_verboseHandlerOutput->enableVerbose();
 		_hooksAttached = true;
+		attachFormattedHandlerIfNeeded();
 	}
 }
 
@@ -153,11 +155,24 @@ void
 MM_VerboseManager::disableVerboseGC()
 {
 	if (_hooksAttached) {
-		_verboseHandlerOutput->disableVerbose();
+		if (_formattedHandlerAttached) {
+			_verboseHandlerOutput->disableVerbose();
+			_formattedHandlerAttached = false;
+		}
 		_hooksAttached = false;
 	}
 }
 
+void
+MM_VerboseManager::attachFormattedHandlerIfNeeded()
+{
+	/* the binary writer hooks the events it records itself, so only pay for formatting if a writer consumes it */
+	if (_hooksAttached && !_formattedHandlerAttached && hasActiveFormattedWriter()) {
+		_verboseHandlerOutput->enableVerbose();
+		_formattedHandlerAttached = true;
+	}
+}
+
 /**
  * Finds an agent of a given type in the event chain.
  * @param type Indicates the type of agent to return.
@@ -198,6 +213,25 @@ MM_VerboseManager::countActiveOutputHandlers()
 	return count;
 }
 
+/**
+ * Determine whether any active writer consumes the formatted output of the verbose handler.
+ * @return true if there is an active writer other than the binary writer
+ */
+bool
+MM_VerboseManager::hasActiveFormattedWriter()
+{
+	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
+
+	while(NULL != writer) {
+		if(writer->isActive() && (VERBOSE_WRITER_FILE_LOGGING_BINARY != writer->getType())) {
+			return true;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	return false;
+}
+
 /**
  * Walks the output agent chain disabling the agents.
  */
@@ -235,6 +269,14 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->verboseBinaryLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_BINARY;
+	}
+
+	if (extensions->verboseAsyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -277,6 +319,8 @@ MM_VerboseManager::configureVerboseGC(OMR_VM *omrVM, char *filename, uintptr_t f
 
 	writer->isActive(true);
 
+	attachFormattedHandlerIfNeeded();
+
 	return true;
 }
 
@@ -315,6 +359,30 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_BINARY:
+		writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
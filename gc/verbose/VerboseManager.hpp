@@ -50,6 +50,7 @@ private:
 protected:
 	MM_VerboseWriterChain* _writerChain; /**< The chain of writers for new verbose */
 	MM_VerboseHandlerOutput *_verboseHandlerOutput;  /**< New verbose format output handler */
+	bool _formattedHandlerAttached; /**< true if _verboseHandlerOutput is hooked (only when a writer consumes formatted output) */
 
 public:
 	
@@ -78,6 +79,11 @@ protected:
 	 */
 	virtual MM_VerboseWriter *findWriterInChain(WriterType type);
 
+	/**
+	 * Hook the formatting verbose handler if verbose is enabled and an active writer consumes its output.
+	 */
+	void attachFormattedHandlerIfNeeded();
+
 	/**
 	 * Disable all verbose writers in the chain.
 	 */
@@ -104,6 +110,12 @@ public:
 	 */
 	virtual uintptr_t countActiveOutputHandlers();
 
+	/**
+	 * Determine whether any active output mechanism consumes formatted (XML) verbose output.
+	 * @return true if the formatting verbose handler needs to be attached.
+	 */
+	virtual bool hasActiveFormattedWriter();
+
 	virtual void enableVerboseGC();
 	virtual void disableVerboseGC();
 
@@ -124,6 +136,7 @@ public:
 		: MM_VerboseManagerBase(omrVM)
 		, _writerChain(NULL)
 		, _verboseHandlerOutput(NULL)
+		, _formattedHandlerAttached(false)
 	{
 	}
 };
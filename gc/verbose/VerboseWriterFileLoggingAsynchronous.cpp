@@ -0,0 +1,475 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBuffer.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include <string.h>
+
+#define DROPPED_OUTPUT_SUMMARY "<warning details=\"verbose output dropped, writer could not keep up\" droppedoutputs=\"%zu\" droppedbytes=\"%zu\" />\n"
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_buffers(NULL)
+	,_bufferCount(0)
+	,_bufferSize(0)
+	,_currentBuffer(NULL)
+	,_filledQueue(NULL)
+	,_filledQueueCapacity(0)
+	,_filledHead(0)
+	,_filledTail(0)
+	,_freeQueue(NULL)
+	,_freeHead(0)
+	,_freeTail(0)
+	,_producerLock(0)
+	,_droppedBytes(0)
+	,_droppedOutputs(0)
+	,_unreportedDroppedBytes(0)
+	,_unreportedDroppedOutputs(0)
+	,_writerMonitor(NULL)
+	,_writerState(WRITER_STATE_ERROR)
+{
+	/* No implementation */
+}
+
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (0 != omrthread_monitor_init_with_name(&_writerMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_writerMonitor")) {
+		return false;
+	}
+
+	_bufferCount = OMR_MAX(extensions->verboseAsyncBufferCount, 2);
+	_bufferSize = OMR_MAX(extensions->verboseAsyncBufferSize, INITIAL_BUFFER_SIZE);
+	_filledQueueCapacity = _bufferCount * 2;
+
+	_buffers = (MM_VerboseBuffer **)extensions->getForge()->allocate(sizeof(MM_VerboseBuffer *) * _bufferCount, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_freeQueue = (MM_VerboseBuffer **)extensions->getForge()->allocate(sizeof(MM_VerboseBuffer *) * _bufferCount, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_filledQueue = (QueueEntry *)extensions->getForge()->allocate(sizeof(QueueEntry) * _filledQueueCapacity, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == _buffers) || (NULL == _freeQueue) || (NULL == _filledQueue)) {
+		return false;
+	}
+	memset(_buffers, 0, sizeof(MM_VerboseBuffer *) * _bufferCount);
+
+	/* every buffer starts out free; buffers are filled with addIfRoom() so they never grow on the reporting thread */
+	for (uintptr_t i = 0; i < _bufferCount; i++) {
+		_buffers[i] = MM_VerboseBuffer::newInstance(env, _bufferSize);
+		if (NULL == _buffers[i]) {
+			return false;
+		}
+		_freeQueue[i] = _buffers[i];
+	}
+	_freeHead = 0;
+	_freeTail = _bufferCount;
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startWriter(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	stopWriter(env);
+	closeFile(env);
+
+	if (NULL != _buffers) {
+		for (uintptr_t i = 0; i < _bufferCount; i++) {
+			if (NULL != _buffers[i]) {
+				_buffers[i]->kill(env);
+			}
+		}
+		extensions->getForge()->free(_buffers);
+		_buffers = NULL;
+	}
+	extensions->getForge()->free(_freeQueue);
+	_freeQueue = NULL;
+	extensions->getForge()->free(_filledQueue);
+	_filledQueue = NULL;
+	_currentBuffer = NULL;
+
+	if (NULL != _writerMonitor) {
+		omrthread_monitor_destroy(_writerMonitor);
+		_writerMonitor = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	stopWriter(env);
+	closeFile(env);
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+	return startWriter(env);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	stopWriter(env);
+	closeFile(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		/* the writer is stopped, so drops not yet summarized would otherwise never be reported */
+		if (0 != _unreportedDroppedOutputs) {
+			omrfile_printf(_logFileDescriptor, DROPPED_OUTPUT_SUMMARY, _unreportedDroppedOutputs, _unreportedDroppedBytes);
+			_unreportedDroppedOutputs = 0;
+			_unreportedDroppedBytes = 0;
+		}
+		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::lockProducer()
+{
+	while (0 != MM_AtomicOperations::lockCompareExchange(&_producerLock, 0, 1)) {
+		MM_AtomicOperations::yieldCPU();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::unlockProducer()
+{
+	MM_AtomicOperations::storeSync();
+	_producerLock = 0;
+}
+
+MM_VerboseBuffer *
+MM_VerboseWriterFileLoggingAsynchronous::popFreeBuffer()
+{
+	MM_VerboseBuffer *buffer = NULL;
+	uintptr_t head = _freeHead;
+	if (head != _freeTail) {
+		MM_AtomicOperations::loadSync();
+		buffer = _freeQueue[head % _bufferCount];
+		MM_AtomicOperations::readWriteBarrier();
+		_freeHead = head + 1;
+	}
+	return buffer;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::publish(MM_VerboseBuffer *buffer, bool endOfCycle)
+{
+	uintptr_t tail = _filledTail;
+	if ((tail - _filledHead) >= _filledQueueCapacity) {
+		return false;
+	}
+	QueueEntry *entry = &_filledQueue[tail % _filledQueueCapacity];
+	entry->buffer = buffer;
+	entry->endOfCycle = endOfCycle;
+	/* the entry, and the buffer contents, must be visible before the writer can see the new tail */
+	MM_AtomicOperations::storeSync();
+	_filledTail = tail + 1;
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::notifyWriter()
+{
+	/* The writer only holds the monitor briefly between waits.  If it is busy it will look at the
+	 * queue again before waiting, and at worst the timed wait bounds the delay, so never block here.
+	 */
+	if (0 == omrthread_monitor_try_enter(_writerMonitor)) {
+		omrthread_monitor_notify(_writerMonitor);
+		omrthread_monitor_exit(_writerMonitor);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = strlen(string);
+	bool wakeWriter = false;
+	char summary[256];
+	uintptr_t summaryLength = 0;
+
+	lockProducer();
+
+	if (0 != _unreportedDroppedOutputs) {
+		summaryLength = omrstr_printf(summary, sizeof(summary), DROPPED_OUTPUT_SUMMARY, _unreportedDroppedOutputs, _unreportedDroppedBytes);
+	}
+
+	/* buffers never grow here, so start another one if this output (and the summary) does not fit */
+	if ((NULL != _currentBuffer) && (0 != _currentBuffer->currentSize()) && ((summaryLength + length) >= _currentBuffer->freeSpace())) {
+		if (publish(_currentBuffer, false)) {
+			_currentBuffer = NULL;
+			wakeWriter = true;
+		}
+	}
+
+	if (NULL == _currentBuffer) {
+		_currentBuffer = popFreeBuffer();
+	}
+
+	bool written = false;
+	if (NULL != _currentBuffer) {
+		if ((0 != summaryLength) && _currentBuffer->addIfRoom(summary)) {
+			_unreportedDroppedOutputs = 0;
+			_unreportedDroppedBytes = 0;
+		}
+		written = _currentBuffer->addIfRoom(string);
+	}
+
+	if (!written) {
+		MM_AtomicOperations::add(&_droppedBytes, length);
+		MM_AtomicOperations::add(&_droppedOutputs, 1);
+		_unreportedDroppedBytes += length;
+		_unreportedDroppedOutputs += 1;
+	}
+
+	unlockProducer();
+
+	if (wakeWriter) {
+		notifyWriter();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	lockProducer();
+	/* A bare marker is queued if there is no current buffer.  If even that does not fit, the writer is
+	 * far behind; the marker is lost and rotation happens one cycle late.
+	 */
+	if (publish(_currentBuffer, true)) {
+		_currentBuffer = NULL;
+	}
+	unlockProducer();
+
+	notifyWriter();
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainQueue(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	while (_filledHead != _filledTail) {
+		MM_AtomicOperations::loadSync();
+		uintptr_t head = _filledHead;
+		QueueEntry entry = _filledQueue[head % _filledQueueCapacity];
+
+		if ((NULL != entry.buffer) && (0 != entry.buffer->currentSize())) {
+			if (-1 == _logFileDescriptor) {
+				/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+				openFile(env);
+			}
+			if (-1 != _logFileDescriptor) {
+				omrfile_write_text(_logFileDescriptor, entry.buffer->contents(), entry.buffer->currentSize());
+			} else {
+				omrfile_write_text(OMRPORT_TTY_ERR, entry.buffer->contents(), entry.buffer->currentSize());
+			}
+		}
+
+		if (entry.endOfCycle) {
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+
+		if (NULL != entry.buffer) {
+			entry.buffer->reset();
+			uintptr_t freeTail = _freeTail;
+			_freeQueue[freeTail % _bufferCount] = entry.buffer;
+			MM_AtomicOperations::storeSync();
+			_freeTail = freeTail + 1;
+		}
+
+		MM_AtomicOperations::readWriteBarrier();
+		_filledHead = head + 1;
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::writerThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->writerEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writerEntryPoint()
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_writerMonitor);
+	_writerState = WRITER_STATE_RUNNING;
+	omrthread_monitor_notify_all(_writerMonitor);
+
+	while (WRITER_STATE_TERMINATION_REQUESTED != _writerState) {
+		if (_filledHead == _filledTail) {
+			omrthread_monitor_wait_timed(_writerMonitor, (int64_t)extensions->verboseAsyncFlushInterval, 0);
+		}
+		omrthread_monitor_exit(_writerMonitor);
+		if (!extensions->fvtest_stallVerboseAsyncWriter) {
+			drainQueue(&env);
+		}
+		omrthread_monitor_enter(_writerMonitor);
+	}
+
+	drainQueue(&env);
+	_writerState = WRITER_STATE_TERMINATED;
+	omrthread_monitor_notify_all(_writerMonitor);
+	omrthread_exit(_writerMonitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startWriter(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that we cannot miss its start-up notification */
+	omrthread_monitor_enter(_writerMonitor);
+	_writerState = WRITER_STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		writerThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (WRITER_STATE_STARTING == _writerState) {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+		success = (WRITER_STATE_RUNNING == _writerState);
+	} else {
+		_writerState = WRITER_STATE_ERROR;
+	}
+	omrthread_monitor_exit(_writerMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopWriter(MM_EnvironmentBase *env)
+{
+	if (NULL == _writerMonitor) {
+		return;
+	}
+
+	/* hand over whatever has been reported so far so that it is written before the writer exits */
+	lockProducer();
+	if ((NULL != _currentBuffer) && publish(_currentBuffer, false)) {
+		_currentBuffer = NULL;
+	}
+	unlockProducer();
+
+	omrthread_monitor_enter(_writerMonitor);
+	if (WRITER_STATE_RUNNING == _writerState) {
+		_writerState = WRITER_STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_writerMonitor);
+		while (WRITER_STATE_TERMINATED != _writerState) {
+			omrthread_monitor_wait(_writerMonitor);
+		}
+	}
+	omrthread_monitor_exit(_writerMonitor);
+}
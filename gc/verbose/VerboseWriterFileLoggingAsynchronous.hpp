@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLogging.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Output agent which directs verbosegc output to file from a dedicated writer thread.
+ *
+ * Output is appended to one of a fixed pool of MM_VerboseBuffer instances, allocated up front and never
+ * grown.  Filled buffers are handed to the writer thread through a lock-free queue and come back through
+ * a second one once written, so the reporting thread neither waits for file I/O nor allocates.  When the
+ * writer falls behind and no buffer is free, output is dropped and counted, as is any single output
+ * larger than a buffer.  A summary of what was dropped is written to the log as soon as a buffer becomes
+ * available again, or when the stream is closed.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef struct QueueEntry {
+		MM_VerboseBuffer *buffer; /**< buffer to write, or NULL for a bare end of cycle marker */
+		bool endOfCycle; /**< true if a GC cycle ended after the contents of buffer */
+	} QueueEntry;
+
+	typedef enum {
+		WRITER_STATE_ERROR = 0,
+		WRITER_STATE_STARTING,
+		WRITER_STATE_RUNNING,
+		WRITER_STATE_TERMINATION_REQUESTED,
+		WRITER_STATE_TERMINATED
+	} WriterState;
+
+	OMR_VM *_omrVM;
+	intptr_t _logFileDescriptor; /**< the file being written to, only touched by the writer thread once it is running */
+
+	MM_VerboseBuffer **_buffers; /**< the buffer pool */
+	uintptr_t _bufferCount;
+	uintptr_t _bufferSize; /**< capacity of each buffer; a buffer is handed to the writer once the next output does not fit */
+	MM_VerboseBuffer *_currentBuffer; /**< buffer being filled by the reporting thread, NULL if none was free */
+
+	QueueEntry *_filledQueue; /**< reporting thread to writer thread, twice _bufferCount entries to leave room for markers */
+	uintptr_t _filledQueueCapacity;
+	volatile uintptr_t _filledHead; /**< advanced by the writer thread */
+	volatile uintptr_t _filledTail; /**< advanced by the reporting thread */
+
+	MM_VerboseBuffer **_freeQueue; /**< writer thread to reporting thread, _bufferCount entries */
+	volatile uintptr_t _freeHead; /**< advanced by the reporting thread */
+	volatile uintptr_t _freeTail; /**< advanced by the writer thread */
+
+	volatile uintptr_t _producerLock; /**< serializes reporting threads; never held across I/O */
+
+	volatile uintptr_t _droppedBytes; /**< total bytes of output dropped under backpressure */
+	volatile uintptr_t _droppedOutputs; /**< total number of output requests dropped under backpressure */
+	uintptr_t _unreportedDroppedBytes; /**< dropped bytes not yet summarized in the log */
+	uintptr_t _unreportedDroppedOutputs; /**< dropped output requests not yet summarized in the log */
+
+	omrthread_monitor_t _writerMonitor; /**< protects _writerState; the writer thread waits on it for work */
+	volatile WriterState _writerState;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	/**
+	 * Hand the current buffer to the writer thread along with the end of cycle, which is where log
+	 * rotation happens.  Rotation is therefore performed by the writer thread, in stream order.
+	 */
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * Stop the writer thread, writing out everything queued so far, and close the file.
+	 */
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * @return total number of bytes of output dropped because the writer thread could not keep up
+	 */
+	MMINLINE uintptr_t getDroppedBytes() { return _droppedBytes; }
+
+	/**
+	 * @return total number of output requests (typically one per verbose stanza) dropped because the writer thread could not keep up
+	 */
+	MMINLINE uintptr_t getDroppedOutputs() { return _droppedOutputs; }
+
+	static int J9THREAD_PROC writerThreadProc(void *info);
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	void lockProducer();
+	void unlockProducer();
+	/**
+	 * Take a buffer from the free queue.  Caller must hold the producer lock.
+	 * @return a buffer, or NULL if all buffers are queued for writing
+	 */
+	MM_VerboseBuffer *popFreeBuffer();
+	/**
+	 * Queue a buffer and/or an end of cycle marker for the writer thread.  Caller must hold the producer lock.
+	 * @return true on success, false if the queue is full
+	 */
+	bool publish(MM_VerboseBuffer *buffer, bool endOfCycle);
+	void notifyWriter();
+
+	bool startWriter(MM_EnvironmentBase *env);
+	void stopWriter(MM_EnvironmentBase *env);
+	void writerEntryPoint();
+	/**
+	 * Write out every queued buffer and return it to the free queue.  Only called by the writer thread.
+	 */
+	void drainQueue(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
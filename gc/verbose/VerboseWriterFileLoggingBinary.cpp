@@ -0,0 +1,702 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrutil.h"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+
+#include "AtomicOperations.hpp"
+#include "CollectionStatistics.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include <string.h>
+
+static void binaryHandlerExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+static void binaryHandlerMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void binaryHandlerScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+static void binaryHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void binaryHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_omrVM(env->getOmrVM())
+	,_mmPrivateHooks(NULL)
+	,_mmOmrHooks(NULL)
+	,_hooksAttached(false)
+	,_logFileDescriptor(-1)
+	,_rings(NULL)
+	,_ringCount(0)
+	,_ringSize(0)
+	,_flusherMonitor(NULL)
+	,_flusherState(FLUSHER_STATE_ERROR)
+	,_flushRequested(false)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if (!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance.
+ * Rotation is not supported, so the file count and cycle count are ignored.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_mmPrivateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	_mmOmrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+
+	if (0 != omrthread_monitor_init_with_name(&_flusherMonitor, 0, "MM_VerboseWriterFileLoggingBinary::_flusherMonitor")) {
+		return false;
+	}
+
+	/* one ring per GC thread; mutator threads share the ring of the master (slave ID 0) */
+	_ringCount = OMR_MAX(extensions->gcThreadCount, 1);
+	_ringSize = 1;
+	while (_ringSize < OMR_MAX(extensions->verboseBinaryBufferSize, 4096)) {
+		_ringSize <<= 1;
+	}
+
+	_rings = (RecordRing *)extensions->getForge()->allocate(sizeof(RecordRing) * _ringCount, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _rings) {
+		return false;
+	}
+	memset(_rings, 0, sizeof(RecordRing) * _ringCount);
+	for (uintptr_t i = 0; i < _ringCount; i++) {
+		_rings[i].buffer = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _rings[i].buffer) {
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, 0, 0)) {
+		return false;
+	}
+
+	if (!startFlusher(env)) {
+		return false;
+	}
+
+	attachHooks();
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Drains whatever is left in the rings before closing the file.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	detachHooks();
+	stopFlusher(env);
+	closeFile(env);
+
+	if (NULL != _rings) {
+		for (uintptr_t i = 0; i < _ringCount; i++) {
+			extensions->getForge()->free(_rings[i].buffer);
+		}
+		extensions->getForge()->free(_rings);
+		_rings = NULL;
+	}
+
+	if (NULL != _flusherMonitor) {
+		omrthread_monitor_destroy(_flusherMonitor);
+		_flusherMonitor = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	stopFlusher(env);
+	closeFile(env);
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, 0, 0)) {
+		return false;
+	}
+	return startFlusher(env);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::closeStream(MM_EnvironmentBase *env)
+{
+	stopFlusher(env);
+	closeFile(env);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::endOfCycle(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_flusherMonitor);
+	_flushRequested = true;
+	omrthread_monitor_notify_all(_flusherMonitor);
+	omrthread_monitor_exit(_flusherMonitor);
+}
+
+/**
+ * Opens the file to log output to and writes the stream header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	VerboseBinaryFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+	header.version = VERBOSE_BINARY_VERSION;
+	header.byteOrderMark = VERBOSE_BINARY_BYTE_ORDER_MARK;
+	header.headerSize = sizeof(header);
+	header.threadCount = (uint32_t)_ringCount;
+	header.hiresFrequency = omrtime_hires_frequency();
+	header.startHiresTime = omrtime_hires_clock();
+	header.startWallTimeMillis = omrtime_current_time_millis();
+	writeToFile(&header, sizeof(header));
+
+	return true;
+}
+
+/**
+ * Closes the file being logged to.  The flusher must be stopped.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (-1 != _logFileDescriptor) {
+		omrfile_sync(_logFileDescriptor);
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeToFile(const void *data, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	const char *cursor = (const char *)data;
+	while ((-1 != _logFileDescriptor) && (0 < length)) {
+		intptr_t written = omrfile_write(_logFileDescriptor, cursor, (intptr_t)length);
+		if (0 >= written) {
+			/* nothing sensible to report to from here; give up on the stream */
+			omrfile_close(_logFileDescriptor);
+			_logFileDescriptor = -1;
+		} else {
+			cursor += written;
+			length -= written;
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::writeRecord(MM_EnvironmentBase *env, VerboseBinaryRecordType type, uint64_t timestamp, const uint64_t *fields, uintptr_t fieldCount)
+{
+	uintptr_t ringIndex = env->getSlaveID() % _ringCount;
+	RecordRing *ring = &_rings[ringIndex];
+	uintptr_t fieldBytes = fieldCount * sizeof(uint64_t);
+	uintptr_t recordSize = sizeof(VerboseBinaryRecordHeader) + fieldBytes;
+
+	/* mutators share a ring; rather than wait for another producer, treat a busy ring like a full one */
+	if (0 != MM_AtomicOperations::lockCompareExchange(&ring->producerLock, 0, 1)) {
+		MM_AtomicOperations::add(&ring->droppedRecords, 1);
+		MM_AtomicOperations::add(&ring->droppedBytes, recordSize);
+		return;
+	}
+
+	uintptr_t tail = ring->tail;
+	uintptr_t head = ring->head;
+	MM_AtomicOperations::readBarrier();
+
+	if ((_ringSize - (tail - head)) < recordSize) {
+		MM_AtomicOperations::add(&ring->droppedRecords, 1);
+		MM_AtomicOperations::add(&ring->droppedBytes, recordSize);
+	} else {
+		VerboseBinaryRecordHeader header;
+		header.length = (uint32_t)recordSize;
+		header.type = (uint16_t)type;
+		header.threadIndex = (uint16_t)ringIndex;
+		header.timestamp = timestamp;
+
+		/* records are multiples of 8 bytes and the ring is a power of two, so a record wraps at most once */
+		uintptr_t mask = _ringSize - 1;
+		const uint8_t *source[] = { (const uint8_t *)&header, (const uint8_t *)fields };
+		uintptr_t sourceLength[] = { sizeof(header), fieldBytes };
+		uintptr_t cursor = tail;
+		for (uintptr_t i = 0; i < 2; i++) {
+			uintptr_t offset = cursor & mask;
+			uintptr_t firstChunk = OMR_MIN(sourceLength[i], _ringSize - offset);
+			memcpy(ring->buffer + offset, source[i], firstChunk);
+			memcpy(ring->buffer, source[i] + firstChunk, sourceLength[i] - firstChunk);
+			cursor += sourceLength[i];
+		}
+
+		/* publish the record to the flusher only once its bytes are visible */
+		MM_AtomicOperations::storeSync();
+		ring->tail = tail + recordSize;
+	}
+
+	MM_AtomicOperations::storeSync();
+	ring->producerLock = 0;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainRings()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uintptr_t mask = _ringSize - 1;
+
+	for (uintptr_t i = 0; i < _ringCount; i++) {
+		RecordRing *ring = &_rings[i];
+		uintptr_t head = ring->head;
+		uintptr_t tail = ring->tail;
+		MM_AtomicOperations::loadSync();
+
+		if (head != tail) {
+			uintptr_t offset = head & mask;
+			uintptr_t length = tail - head;
+			uintptr_t firstChunk = OMR_MIN(length, _ringSize - offset);
+			writeToFile(ring->buffer + offset, firstChunk);
+			writeToFile(ring->buffer, length - firstChunk);
+
+			/* make sure the copy out is complete before handing the space back to producers */
+			MM_AtomicOperations::readWriteBarrier();
+			ring->head = tail;
+		}
+
+		uintptr_t droppedRecords = ring->droppedRecords;
+		if (0 != droppedRecords) {
+			uintptr_t droppedBytes = ring->droppedBytes;
+			MM_AtomicOperations::subtract(&ring->droppedRecords, droppedRecords);
+			MM_AtomicOperations::subtract(&ring->droppedBytes, droppedBytes);
+
+			struct {
+				VerboseBinaryRecordHeader header;
+				uint64_t fields[2];
+			} record;
+			record.header.length = sizeof(record);
+			record.header.type = VERBOSE_BINARY_RECORD_RECORDS_DROPPED;
+			record.header.threadIndex = (uint16_t)i;
+			record.header.timestamp = omrtime_hires_clock();
+			record.fields[0] = droppedRecords;
+			record.fields[1] = droppedBytes;
+			writeToFile(&record, sizeof(record));
+		}
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingBinary::flusherThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)info;
+	writer->flusherEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flusherEntryPoint()
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_STATE_RUNNING;
+	omrthread_monitor_notify_all(_flusherMonitor);
+
+	while (FLUSHER_STATE_TERMINATION_REQUESTED != _flusherState) {
+		if (!_flushRequested) {
+			omrthread_monitor_wait_timed(_flusherMonitor, (int64_t)extensions->verboseBinaryFlushInterval, 0);
+		}
+		_flushRequested = false;
+
+		/* producers never take the monitor, but endOfCycle does, so do not hold it over file I/O */
+		omrthread_monitor_exit(_flusherMonitor);
+		drainRings();
+		omrthread_monitor_enter(_flusherMonitor);
+	}
+
+	drainRings();
+	_flusherState = FLUSHER_STATE_TERMINATED;
+	omrthread_monitor_notify_all(_flusherMonitor);
+	omrthread_exit(_flusherMonitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::startFlusher(MM_EnvironmentBase *env)
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that we cannot miss its start-up notification */
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_STATE_STARTING;
+	_flushRequested = false;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		flusherThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (FLUSHER_STATE_STARTING == _flusherState) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		success = (FLUSHER_STATE_RUNNING == _flusherState);
+	} else {
+		_flusherState = FLUSHER_STATE_ERROR;
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::stopFlusher(MM_EnvironmentBase *env)
+{
+	if (NULL == _flusherMonitor) {
+		return;
+	}
+
+	omrthread_monitor_enter(_flusherMonitor);
+	if (FLUSHER_STATE_RUNNING == _flusherState) {
+		_flusherState = FLUSHER_STATE_TERMINATION_REQUESTED;
+		omrthread_monitor_notify_all(_flusherMonitor);
+		while (FLUSHER_STATE_TERMINATED != _flusherState) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::attachHooks()
+{
+	if (_hooksAttached) {
+		return;
+	}
+
+	/* Exclusive */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, binaryHandlerExclusiveStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, binaryHandlerExclusiveEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, binaryHandlerCycleStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, binaryHandlerCycleEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, binaryHandlerGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, binaryHandlerGCEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* GCOps */
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, binaryHandlerMarkEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, binaryHandlerSweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, binaryHandlerScavengeEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/* Concurrent */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, binaryHandlerConcurrentKickoff, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, binaryHandlerConcurrentAborted, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+	_hooksAttached = true;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::detachHooks()
+{
+	if (!_hooksAttached) {
+		return;
+	}
+
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, binaryHandlerExclusiveStart, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, binaryHandlerExclusiveEnd, (void *)this);
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, binaryHandlerCycleStart, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, binaryHandlerCycleEnd, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, binaryHandlerGCStart, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, binaryHandlerGCEnd, (void *)this);
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, binaryHandlerMarkEnd, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, binaryHandlerSweepEnd, (void *)this);
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, binaryHandlerScavengeEnd, (void *)this);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, binaryHandlerConcurrentKickoff, (void *)this);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_ABORTED, binaryHandlerConcurrentAborted, (void *)this);
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+	_hooksAttached = false;
+}
+
+/*
+ * Hook handlers.  These run on the GC critical path, so they only gather raw values and leave
+ * every unit conversion and all formatting to the decoder.
+ */
+
+static uintptr_t
+currentCycleType(MM_EnvironmentBase *env)
+{
+	return (NULL == env->_cycleState) ? 0 : env->_cycleState->_type;
+}
+
+static void
+binaryHandlerExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ExclusiveAccessAcquireEvent *event = (MM_ExclusiveAccessAcquireEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		uint64_t fields[] = { event->exclusiveAccessTime, event->meanIdleTime, event->haltedThreads };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_EXCLUSIVE_START, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ExclusiveAccessReleaseEvent *event = (MM_ExclusiveAccessReleaseEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_EXCLUSIVE_END, event->timestamp, NULL, 0);
+		writer->endOfCycle(env);
+	}
+}
+
+static void
+binaryHandlerCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_GCCycleStartEvent *event = (MM_GCCycleStartEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+		MM_CommonGCData *commonData = event->commonData;
+		uint64_t fields[] = { event->cycleType, commonData->nurseryFreeBytes, commonData->nurseryTotalBytes, commonData->tenureFreeBytes, commonData->tenureTotalBytes };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_CYCLE_START, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_GCPostCycleEndEvent *event = (MM_GCPostCycleEndEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_CommonGCData *commonData = event->commonData;
+		uint64_t fields[] = { event->cycleType, commonData->nurseryFreeBytes, commonData->nurseryTotalBytes, commonData->tenureFreeBytes, commonData->tenureTotalBytes, event->workStackOverflowCount };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_CYCLE_END, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_GCIncrementStartEvent *event = (MM_GCIncrementStartEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+		uint64_t fields[] = { currentCycleType(env), stats->_totalHeapSize, stats->_totalFreeHeapSize };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_INCREMENT_START, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_GCIncrementEndEvent *event = (MM_GCIncrementEndEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+		uint64_t fields[] = {
+			currentCycleType(env),
+			stats->_totalHeapSize,
+			stats->_totalFreeHeapSize,
+			stats->_endTime - stats->_startTime,
+			(uint64_t)(stats->_endProcessTimes._userTime - stats->_startProcessTimes._userTime),
+			(uint64_t)(stats->_endProcessTimes._systemTime - stats->_startProcessTimes._systemTime)
+		};
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_INCREMENT_END, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+static void
+binaryHandlerMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_MarkEndEvent *event = (MM_MarkEndEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_MarkStats *markStats = &env->getExtensions()->globalGCStats.markStats;
+		uint64_t fields[] = { markStats->_endTime - markStats->_startTime, markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_MARK_END, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_SweepEndEvent *event = (MM_SweepEndEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_SweepStats *sweepStats = &env->getExtensions()->globalGCStats.sweepStats;
+		uint64_t fields[] = { sweepStats->_endTime - sweepStats->_startTime };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_SWEEP_END, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void
+binaryHandlerScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ScavengeEndEvent *event = (MM_ScavengeEndEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		MM_ScavengerStats *scavengerStats = &extensions->incrementScavengerStats;
+		uint64_t fields[] = {
+			scavengerStats->_endTime - scavengerStats->_startTime,
+			scavengerStats->_flipCount,
+			scavengerStats->_flipBytes,
+			scavengerStats->_tenureAggregateCount,
+			scavengerStats->_tenureAggregateBytes,
+			scavengerStats->_failedFlipCount,
+			scavengerStats->_failedTenureCount,
+			extensions->scavengerStats._tenureAge,
+			scavengerStats->_backout
+		};
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_SCAVENGE_END, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+static void
+binaryHandlerConcurrentKickoff(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ConcurrentKickoffEvent *event = (MM_ConcurrentKickoffEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		uint64_t fields[] = { event->reason, event->traceTarget, event->kickOffThreshold, event->remainingFree };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_CONCURRENT_KICKOFF, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+
+static void
+binaryHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_ConcurrentAbortedEvent *event = (MM_ConcurrentAbortedEvent *)eventData;
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)userData;
+	if (writer->isActive()) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+		uint64_t fields[] = { event->reason };
+		writer->writeRecord(env, VERBOSE_BINARY_RECORD_CONCURRENT_ABORTED, event->timestamp, fields, sizeof(fields) / sizeof(fields[0]));
+	}
+}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrhookable.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which records verbose GC events to file in the compact binary format described
+ * in VerboseBinaryFormat.hpp.
+ *
+ * The writer hooks the GC events itself rather than consuming the XML produced by the verbose handler,
+ * so enabling it alone avoids all string formatting on the GC path.  Events are packed into preallocated
+ * per-thread ring buffers without allocating, waiting or taking a monitor, and a dedicated flusher thread
+ * drains the rings to disk periodically and at the end of every cycle.  A ring that is full, or busy with
+ * a record from another thread, drops the record; the drop is reported in the stream as a
+ * VERBOSE_BINARY_RECORD_RECORDS_DROPPED record.
+ *
+ * File rotation is not supported, the stream is always written to a single file.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Single producer ring of records.  A producer owns the ring while it holds producerLock, the flusher is the only consumer.
+	 */
+	typedef struct RecordRing {
+		uint8_t *buffer; /**< ring storage, _ringSize bytes */
+		volatile uintptr_t head; /**< total bytes consumed by the flusher */
+		volatile uintptr_t tail; /**< total bytes published by producers */
+		volatile uintptr_t producerLock; /**< 0 when free, 1 while a producer is writing a record */
+		volatile uintptr_t droppedRecords; /**< records dropped because the ring was full or busy, not yet reported */
+		volatile uintptr_t droppedBytes; /**< bytes dropped because the ring was full or busy, not yet reported */
+	} RecordRing;
+
+	typedef enum {
+		FLUSHER_STATE_ERROR = 0,
+		FLUSHER_STATE_STARTING,
+		FLUSHER_STATE_RUNNING,
+		FLUSHER_STATE_TERMINATION_REQUESTED,
+		FLUSHER_STATE_TERMINATED
+	} FlusherState;
+
+	OMR_VM *_omrVM;
+	J9HookInterface **_mmPrivateHooks; /**< GC private hook interface */
+	J9HookInterface **_mmOmrHooks; /**< GC OMR hook interface */
+	bool _hooksAttached;
+
+	intptr_t _logFileDescriptor; /**< the file being written to, or -1 */
+
+	RecordRing *_rings; /**< per-thread record rings, indexed by GC slave ID */
+	uintptr_t _ringCount;
+	uintptr_t _ringSize; /**< bytes per ring, a power of two */
+
+	omrthread_monitor_t _flusherMonitor; /**< protects _flusherState, the log file and drain of the rings */
+	volatile FlusherState _flusherState;
+	bool _flushRequested;
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * The binary stream is fed directly from the GC hooks, so formatted verbose output is ignored.
+	 */
+	virtual void outputString(MM_EnvironmentBase *env, const char* string) {}
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * Stop the flusher, draining the rings, and close the file.
+	 */
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * Wake the flusher at the end of a cycle so that a completed cycle reaches the disk promptly.
+	 */
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	/**
+	 * Pack a record into the ring of the calling thread.  Never blocks and never allocates;
+	 * if the ring has no room, or another thread is writing to it, the record is dropped and counted.
+	 * @param env[in] the thread reporting the event
+	 * @param type[in] the VerboseBinaryRecordType of the record
+	 * @param timestamp[in] hires clock ticks at the time of the event
+	 * @param fields[in] the record payload
+	 * @param fieldCount[in] number of payload fields, at most VERBOSE_BINARY_MAX_FIELDS
+	 */
+	void writeRecord(MM_EnvironmentBase *env, VerboseBinaryRecordType type, uint64_t timestamp, const uint64_t *fields, uintptr_t fieldCount);
+
+	static int J9THREAD_PROC flusherThreadProc(void *info);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startFlusher(MM_EnvironmentBase *env);
+	void stopFlusher(MM_EnvironmentBase *env);
+	void flusherEntryPoint();
+
+	/**
+	 * Write everything published in the rings to the log file.  Caller must hold _flusherMonitor.
+	 */
+	void drainRings();
+	void writeToFile(const void *data, uintptr_t length);
+
+	void attachHooks();
+	void detachHooks();
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
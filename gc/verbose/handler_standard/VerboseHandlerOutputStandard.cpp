@@ -302,8 +302,9 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
-			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" workStackOverflowCount=\"%zu\" />",
+			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned,
+			extensions->globalGCStats.workPacketStats.getSTWWorkStackOverflowCount());
 
 	handleMarkEndInternal(env, eventData);
 
@@ -438,6 +439,18 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_nonTemporalCopyCount) {
+		writer->formatAndOutput(env, 1, "<copy-nontemporal objects=\"%llu\" bytes=\"%llu\" />",
+				scavengerStats->_nonTemporalCopyCount, scavengerStats->_nonTemporalCopyBytes);
+	}
+	if (1 < extensions->scavengerSurvivorAgeStreams) {
+		for (uintptr_t stream = 0; stream < SCAVENGER_SURVIVOR_AGE_STREAMS_MAX; stream++) {
+			if (0 != scavengerStats->_survivorAgeStreamFlipCounts[stream]) {
+				writer->formatAndOutput(env, 1, "<survivor-age-stream stream=\"%zu\" objects=\"%llu\" bytes=\"%llu\" />",
+						stream, scavengerStats->_survivorAgeStreamFlipCounts[stream], scavengerStats->_survivorAgeStreamFlipBytes[stream]);
+			}
+		}
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -648,6 +661,9 @@ MM_VerboseHandlerOutputStandard::getConcurrentKickoffReason(void *eventData)
 	case NEXT_SCAVENGE_WILL_PERCOLATE:
 		reasonString = "next scavenge will percolate";
 		break;
+	case ALLOCATION_RATE_FORECAST:
+		reasonString = "allocation rate forecast";
+		break;
 	case NO_KICKOFF_REASON:
 		/* Should never be the case */
 		reasonString = "none";
@@ -747,6 +763,10 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCollectionStart(J9HookInterface
 		tagTemplate, deltaTime / 1000, deltaTime % 1000);
 	writer->formatAndOutput(env, 1, "<concurrent-trace-info reason=\"%s\" tracedByMutators=\"%zu\" tracedByHelpers=\"%zu\" cardsCleaned=\"%zu\" workStackOverflowCount=\"%zu\" />",
 		cardCleaningReasonString, event->tracedByMutators, event->tracedByHelpers, event->cardsCleaned, event->workStackOverflowCount);
+	if (MM_GCExtensionsBase::getExtensions(env->getOmrVM())->concurrentAssistPacing) {
+		writer->formatAndOutput(env, 1, "<concurrent-assist payments=\"%zu\" deferred=\"%zu\" installments=\"%zu\" />",
+			event->assistPaymentCount, event->assistDeferredCount, event->assistInstallmentCount);
+	}
   	writer->formatAndOutput(env, 0, "</concurrent-collection-start>");
 
 	writer->flush(env);
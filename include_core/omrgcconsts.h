@@ -248,6 +248,11 @@ struct ModronLnrlOptions {
  */
 #define PACKET_ARRAY_SPLIT_SHIFT 2
 #define PACKET_INVALID_OBJECT (UDATA_MAX << PACKET_ARRAY_SPLIT_SHIFT)
+/*
+ * With edge marking, work packets also hold slot addresses tagged with PACKET_EDGE_TAG alone.
+ * Array split entries always have PACKET_ARRAY_SPLIT_TAG set, so the two never collide.
+ */
+#define PACKET_EDGE_TAG 2
 
 #define OLDFREE_DESPERATE_RATIO_DIVISOR			100
 #define OLDFREE_DESPERATE_RATIO_MULTIPLIER		4
@@ -308,7 +313,8 @@ typedef enum {
 	NO_KICKOFF_REASON=1,
 	KICKOFF_THRESHOLD_REACHED,
 	NEXT_SCAVENGE_WILL_PERCOLATE,
-	LANGUAGE_DEFINED_REASON
+	LANGUAGE_DEFINED_REASON,
+	ALLOCATION_RATE_FORECAST
 } ConcurrentKickoffReason;
 
 /**
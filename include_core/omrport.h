@@ -380,6 +380,10 @@ typedef struct J9PortVmemParams {
 	 *		- If set, return whatever mmap gives us (only one allocation attempt)
 	 *		- this option is based on the observation that mmap would take the given address as a hint about where to place the mapping
 	 *		- this option does not apply to large page allocations as the allocation is done with shmat instead of mmap
+	 * \arg OMRPORT_VMEM_TRANSPARENT_HUGE_PAGES
+	 *		- enabled for Linux and default page allocations only, ignored on all other platforms
+	 *		- If set, the reserved range is advised (MADV_HUGEPAGE) to be backed by transparent huge pages
+	 *		  as it is committed and touched; the advice is best effort and does not fail the reservation
 	 */
 	uintptr_t options;
 
@@ -423,6 +427,7 @@ typedef struct OMRCgroupEntry {
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
+#define OMRPORT_VMEM_TRANSPARENT_HUGE_PAGES 256
 
 /**
  * @name Virtual Memory Address
@@ -729,6 +734,10 @@ typedef struct J9ProcessorInfos {
 #define OMRPORT_MMAP_SYNC_WAIT  0x80
 #define OMRPORT_MMAP_SYNC_ASYNC  0x100
 #define OMRPORT_MMAP_SYNC_INVALIDATE  0x200
+#define OMRPORT_MMAP_DONT_NEED_LAZY  0x1
+#define OMRPORT_MMAP_DONT_NEED_NOT_RELEASED  0
+#define OMRPORT_MMAP_DONT_NEED_RELEASED  1
+#define OMRPORT_MMAP_DONT_NEED_ZEROED  2
 
 #define OMRPORT_SIG_FLAG_MAY_RETURN  1
 #define OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION  2
@@ -1484,6 +1493,8 @@ typedef struct OMRPortLibrary {
 	uintptr_t (*mmap_get_region_granularity)(struct OMRPortLibrary *portLibrary, void *address) ;
 	/** see @ref omrmmap.c::omrmmap_dont_need "omrmmap_dont_need"*/
 	void (*mmap_dont_need)(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length) ;
+	/** see @ref omrmmap.c::omrmmap_dont_need_ex "omrmmap_dont_need_ex"*/
+	int32_t (*mmap_dont_need_ex)(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_get_limit "omrsysinfo_get_limit"*/
 	uint32_t (*sysinfo_get_limit)(struct OMRPortLibrary *portLibrary, uint32_t resourceID, uint64_t *limit) ;
 	/** see @ref omrsysinfo.c::omrsysinfo_set_limit "omrsysinfo_set_limit"*/
@@ -1964,6 +1975,7 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrmmap_protect(param1,param2,param3) privateOmrPortLibrary->mmap_protect(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrmmap_get_region_granularity(param1) privateOmrPortLibrary->mmap_get_region_granularity(privateOmrPortLibrary, (param1))
 #define omrmmap_dont_need(param1, param2) privateOmrPortLibrary->mmap_dont_need(privateOmrPortLibrary, (param1), param2)
+#define omrmmap_dont_need_ex(param1, param2, param3) privateOmrPortLibrary->mmap_dont_need_ex(privateOmrPortLibrary, (param1), (param2), (param3))
 #define omrsysinfo_get_limit(param1,param2) privateOmrPortLibrary->sysinfo_get_limit(privateOmrPortLibrary, (param1), (param2))
 #define omrsysinfo_set_limit(param1,param2) privateOmrPortLibrary->sysinfo_set_limit(privateOmrPortLibrary, (param1), (param2))
 #define omrsysinfo_get_number_CPUs_by_type(param1) privateOmrPortLibrary->sysinfo_get_number_CPUs_by_type(privateOmrPortLibrary, (param1))
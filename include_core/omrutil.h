@@ -336,6 +336,17 @@ uintptr_t getCacheLineSize(void);
 */
 void OMRZeroMemory(void *ptr, uintptr_t length);
 
+/**
+* @brief Zero memory with stores that bypass the data cache where the platform has them
+* (SSE2 streaming stores on x86-64), falling back to OMRZeroMemory elsewhere.  Meant for
+* large ranges that will not be touched again soon, so zeroing them does not evict the
+* working set.  The stores are complete and ordered before the function returns.
+* @param *ptr
+* @param length
+* @return void
+*/
+void OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length);
+
 
 /**
 * @brief
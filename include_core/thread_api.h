@@ -1368,6 +1368,33 @@ omrthread_get_os_errno2(void);
 #endif /* J9ZOS390 */
 
 
+/* -------------- omrthreadaddress.c ------------------- */
+
+/**
+ * @brief Answer whether the platform can block a thread on the value of a memory word.
+ * @return BOOLEAN
+ */
+BOOLEAN
+omrthread_address_wait_supported(void);
+
+/**
+ * @brief Block the calling thread while *address holds value, until omrthread_address_wake_all() is called on address.
+ * @param address
+ * @param value
+ * @return intptr_t
+ */
+intptr_t
+omrthread_address_wait(volatile uint32_t *address, uint32_t value);
+
+/**
+ * @brief Wake every thread blocked in omrthread_address_wait() on address.
+ * @param address
+ * @return intptr_t
+ */
+intptr_t
+omrthread_address_wake_all(volatile uint32_t *address);
+
+
 /* -------------- omrthreadnuma.c ------------------- */
 /* success code for trheadnuma API */
 #define J9THREAD_NUMA_OK 					0
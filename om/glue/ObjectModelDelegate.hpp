@@ -104,6 +104,18 @@ public:
 		}
 	}
 
+	/**
+	 * Get the key that identifies the type of an object in a heap census.
+	 * Objects with equal keys are counted together. Objects are keyed by their
+	 * shape, so objects with the same layout share a key.
+	 *
+	 * @param[in] objectPtr points to the object
+	 * @return the census key of the object
+	 */
+	MMINLINE uintptr_t getObjectCensusKey(const Any* any) {
+		return reinterpret_cast<uintptr_t>(any->as.cell.layout());
+	}
+
 	/**
 	 * Get the total footprint of an object, in bytes, including the object
 	 * header and all data. If the object has a discontiguous representation,
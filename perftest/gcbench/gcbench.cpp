@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * Summarize the verbose GC logs of a gcBenchmark run as JSON.
+ *
+ * Usage: omrgcbench [-keepVerboseLog] [-o <file>]
+ *
+ * Reads every VerboseGCBench-<workload>-<policy>_*.xml file in the current directory, as written by
+ * `omrgctest --gtest_filter="gcBenchmark*" -keepVerboseLog`, and reports for each workload and policy:
+ *  - allocation throughput: bytes allocated between collections divided by the elapsed time up to the
+ *    end of the last collection
+ *  - stop-the-world pause percentiles (p50, p99, p99.9, max), taken from exclusive access durations
+ *  - TLH refreshes and the unused TLH memory abandoned back to the heap
+ *  - GC CPU time, the user and system time of all collections
+ *
+ * Logs of repeated runs (--gtest_repeat) of the same workload and policy are aggregated into one result.
+ * The logs are deleted once analyzed unless -keepVerboseLog is given.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pugixml.hpp"
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+static const char *SRC_DIR = "./";
+static const char *VERBOSE_GC_FILE_PREFIX = "VerboseGCBench-";
+
+struct BenchmarkResult {
+	std::string workload;
+	std::string policy;
+	uintptr_t runs;
+	uintptr_t gcCount;
+	double elapsedms; /**< mutator and GC time, up to the end of the last collection of each run */
+	double allocatedBytes;
+	double tlhRefreshes;
+	double tlhAbandonedBytes; /**< unused TLH memory given back to the heap */
+	double gcCPUms;
+	std::vector<double> pausems;
+
+	BenchmarkResult()
+		: runs(0)
+		, gcCount(0)
+		, elapsedms(0.0)
+		, allocatedBytes(0.0)
+		, tlhRefreshes(0.0)
+		, tlhAbandonedBytes(0.0)
+		, gcCPUms(0.0)
+	{}
+};
+
+typedef std::map<std::string, BenchmarkResult> BenchmarkResults;
+
+/**
+ * Split "VerboseGCBench-<workload>-<policy>_<pid>_<time>.xml" into its workload and policy.
+ */
+static bool
+parseFileName(const char *fileName, std::string *workload, std::string *policy)
+{
+	const char *start = fileName + strlen(VERBOSE_GC_FILE_PREFIX);
+	const char *dash = strchr(start, '-');
+	if (NULL == dash) {
+		return false;
+	}
+	const char *underscore = strchr(dash, '_');
+	if (NULL == underscore) {
+		return false;
+	}
+	workload->assign(start, dash - start);
+	policy->assign(dash + 1, underscore - (dash + 1));
+	return true;
+}
+
+static bool
+analyze(const char *fileName, BenchmarkResults *results)
+{
+	std::string workload;
+	std::string policy;
+	if (!parseFileName(fileName, &workload, &policy)) {
+		fprintf(stderr, "Skipping %s: expected %s<workload>-<policy>_*.xml\n", fileName, VERBOSE_GC_FILE_PREFIX);
+		return false;
+	}
+
+	pugi::xml_document doc;
+	pugi::xml_parse_result parseResult = doc.load_file(fileName);
+	if (!parseResult) {
+		fprintf(stderr, "Error loading file %s: %s\n", fileName, parseResult.description());
+		return false;
+	}
+
+	BenchmarkResult *result = &(*results)[workload + "-" + policy];
+	result->workload = workload;
+	result->policy = policy;
+	result->runs += 1;
+
+	double lastPausems = 0.0;
+	for (pugi::xml_node node = doc.child("verbosegc").first_child(); node; node = node.next_sibling()) {
+		const char *name = node.name();
+		if (0 == strcmp(name, "exclusive-start")) {
+			/* time since the start of the previous exclusive access, or since the log was opened */
+			result->elapsedms += node.attribute("intervalms").as_double();
+		} else if (0 == strcmp(name, "exclusive-end")) {
+			lastPausems = node.attribute("durationms").as_double();
+			result->pausems.push_back(lastPausems);
+		} else if (0 == strcmp(name, "allocation-stats")) {
+			result->allocatedBytes += node.attribute("totalBytes").as_double();
+			pugi::xml_node tlhStats = node.child("tlh-stats");
+			result->tlhRefreshes += tlhStats.attribute("refreshes").as_double();
+			result->tlhAbandonedBytes += tlhStats.attribute("abandoned").as_double();
+		} else if (0 == strcmp(name, "gc-end")) {
+			result->gcCount += 1;
+			result->gcCPUms += node.attribute("usertimems").as_double() + node.attribute("systemtimems").as_double();
+		}
+	}
+	result->elapsedms += lastPausems;
+
+	return true;
+}
+
+/**
+ * Nearest-rank percentile of an ascending sample.
+ */
+static double
+percentile(const std::vector<double> &sorted, double fraction)
+{
+	if (sorted.empty()) {
+		return 0.0;
+	}
+	size_t rank = (size_t)ceil(fraction * (double)sorted.size());
+	if (0 < rank) {
+		rank -= 1;
+	}
+	return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+static void
+report(FILE *out, BenchmarkResults *results)
+{
+	fprintf(out, "{\n  \"benchmarks\": [");
+	const char *separator = "\n";
+	for (BenchmarkResults::iterator it = results->begin(); it != results->end(); ++it) {
+		BenchmarkResult *result = &it->second;
+		std::sort(result->pausems.begin(), result->pausems.end());
+
+		double totalPausems = 0.0;
+		for (size_t i = 0; i < result->pausems.size(); i++) {
+			totalPausems += result->pausems[i];
+		}
+		double throughput = 0.0;
+		double gcCPUPercent = 0.0;
+		if (0.0 < result->elapsedms) {
+			throughput = (result->allocatedBytes / (1024.0 * 1024.0)) / (result->elapsedms / 1000.0);
+			gcCPUPercent = (result->gcCPUms * 100.0) / result->elapsedms;
+		}
+
+		fprintf(out, "%s    {\n", separator);
+		fprintf(out, "      \"workload\": \"%s\",\n", result->workload.c_str());
+		fprintf(out, "      \"policy\": \"%s\",\n", result->policy.c_str());
+		fprintf(out, "      \"runs\": %zu,\n", (size_t)result->runs);
+		fprintf(out, "      \"gcCount\": %zu,\n", (size_t)result->gcCount);
+		fprintf(out, "      \"elapsedMs\": %.3f,\n", result->elapsedms);
+		fprintf(out, "      \"allocatedBytes\": %.0f,\n", result->allocatedBytes);
+		fprintf(out, "      \"allocationThroughputMBPerSec\": %.3f,\n", throughput);
+		fprintf(out, "      \"tlhRefreshes\": %.0f,\n", result->tlhRefreshes);
+		fprintf(out, "      \"tlhAbandonedBytes\": %.0f,\n", result->tlhAbandonedBytes);
+		fprintf(out, "      \"pauseMs\": {\n");
+		fprintf(out, "        \"count\": %zu,\n", result->pausems.size());
+		fprintf(out, "        \"total\": %.3f,\n", totalPausems);
+		fprintf(out, "        \"p50\": %.3f,\n", percentile(result->pausems, 0.50));
+		fprintf(out, "        \"p99\": %.3f,\n", percentile(result->pausems, 0.99));
+		fprintf(out, "        \"p99.9\": %.3f,\n", percentile(result->pausems, 0.999));
+		fprintf(out, "        \"max\": %.3f\n", result->pausems.empty() ? 0.0 : result->pausems.back());
+		fprintf(out, "      },\n");
+		fprintf(out, "      \"gcCpuMs\": %.3f,\n", result->gcCPUms);
+		fprintf(out, "      \"gcCpuPercent\": %.3f\n", gcCPUPercent);
+		fprintf(out, "    }");
+		separator = ",\n";
+	}
+	fprintf(out, "\n  ]\n}\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	bool keepLog = false;
+	const char *outFileName = NULL;
+	char resultBuffer[128];
+	OMRPortLibrary portLibrary;
+	BenchmarkResults results;
+	int rc = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-keepVerboseLog")) {
+			keepLog = true;
+		} else if ((0 == strcmp(argv[i], "-o")) && ((i + 1) < argc)) {
+			outFileName = argv[++i];
+		} else {
+			fprintf(stderr, "usage: %s [-keepVerboseLog] [-o <file>]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if (0 != omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT)) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed\n");
+		return 1;
+	}
+	if (0 != omrport_init_library(&portLibrary, sizeof(OMRPortLibrary))) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)) failed\n");
+		omrthread_detach(NULL);
+		return 1;
+	}
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t handle = omrfile_findfirst(SRC_DIR, resultBuffer);
+	uintptr_t rcFile = handle;
+	while ((uintptr_t)-1 != rcFile) {
+		if (0 == strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX))) {
+			if (analyze(resultBuffer, &results) && !keepLog) {
+				omrfile_unlink(resultBuffer);
+			}
+		}
+		rcFile = omrfile_findnext(handle, resultBuffer);
+	}
+	if ((uintptr_t)-1 != handle) {
+		omrfile_findclose(handle);
+	}
+
+	if (results.empty()) {
+		fprintf(stderr, "Failed to find any %s*.xml verbose GC file to process!\n", VERBOSE_GC_FILE_PREFIX);
+		rc = 1;
+	} else {
+		FILE *out = stdout;
+		if (NULL != outFileName) {
+			out = fopen(outFileName, "w");
+			if (NULL == out) {
+				fprintf(stderr, "cannot open %s\n", outFileName);
+				rc = 1;
+			}
+		}
+		if (NULL != out) {
+			report(out, &results);
+			if (stdout != out) {
+				fclose(out);
+			}
+		}
+	}
+
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return rc;
+}
@@ -46,4 +46,11 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+omr_gcbench:
+	./omrgctest --gtest_filter="gcBenchmark*" -keepVerboseLog
+	./omrgcbench -o omrgcbench.json
+
+omr_gcbarrierbench:
+	./omrgctest --gtest_filter="gcBarrierBenchmark*" -logLevel=info
+
+.PHONY: all test omr_perfgctest omr_gcbench omr_gcbarrierbench 
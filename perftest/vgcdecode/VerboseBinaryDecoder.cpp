@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * Reader for binary verbose GC streams, see VerboseBinaryDecoder.hpp.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "VerboseBinaryDecoder.hpp"
+
+enum FieldKind {
+	FIELD_COUNT, /**< printed as is */
+	FIELD_TICKS, /**< hires clock ticks, printed as milliseconds */
+	FIELD_NANOS /**< nanoseconds, printed as milliseconds */
+};
+
+struct FieldDescription {
+	const char *name;
+	FieldKind kind;
+};
+
+struct RecordDescription {
+	const char *name;
+	uintptr_t fieldCount;
+	FieldDescription fields[VERBOSE_BINARY_MAX_FIELDS];
+};
+
+/* indexed by VerboseBinaryRecordType; keep in sync with VerboseBinaryFormat.hpp */
+static const RecordDescription recordDescriptions[] = {
+	{ "none", 0, {} },
+	{ "exclusive-start", 3, { {"timems", FIELD_TICKS}, {"idlems", FIELD_TICKS}, {"threads", FIELD_COUNT} } },
+	{ "exclusive-end", 0, {} },
+	{ "cycle-start", 5, { {"cycletype", FIELD_COUNT}, {"nurseryfree", FIELD_COUNT}, {"nurserytotal", FIELD_COUNT}, {"tenurefree", FIELD_COUNT}, {"tenuretotal", FIELD_COUNT} } },
+	{ "cycle-end", 6, { {"cycletype", FIELD_COUNT}, {"nurseryfree", FIELD_COUNT}, {"nurserytotal", FIELD_COUNT}, {"tenurefree", FIELD_COUNT}, {"tenuretotal", FIELD_COUNT}, {"workstackoverflowcount", FIELD_COUNT} } },
+	{ "gc-start", 3, { {"cycletype", FIELD_COUNT}, {"totalheap", FIELD_COUNT}, {"freeheap", FIELD_COUNT} } },
+	{ "gc-end", 6, { {"cycletype", FIELD_COUNT}, {"totalheap", FIELD_COUNT}, {"freeheap", FIELD_COUNT}, {"durationms", FIELD_TICKS}, {"usertimems", FIELD_NANOS}, {"systemtimems", FIELD_NANOS} } },
+	{ "mark", 4, { {"timems", FIELD_TICKS}, {"objectcount", FIELD_COUNT}, {"scancount", FIELD_COUNT}, {"scanbytes", FIELD_COUNT} } },
+	{ "sweep", 1, { {"timems", FIELD_TICKS} } },
+	{ "scavenge", 9, { {"timems", FIELD_TICKS}, {"nurseryobjects", FIELD_COUNT}, {"nurserybytes", FIELD_COUNT}, {"tenureobjects", FIELD_COUNT}, {"tenurebytes", FIELD_COUNT}, {"nurseryfailed", FIELD_COUNT}, {"tenurefailed", FIELD_COUNT}, {"tenureage", FIELD_COUNT}, {"backout", FIELD_COUNT} } },
+	{ "concurrent-kickoff", 4, { {"reason", FIELD_COUNT}, {"targetbytes", FIELD_COUNT}, {"thresholdbytes", FIELD_COUNT}, {"remainingbytes", FIELD_COUNT} } },
+	{ "concurrent-aborted", 1, { {"reason", FIELD_COUNT} } },
+	{ "records-dropped", 2, { {"records", FIELD_COUNT}, {"bytes", FIELD_COUNT} } },
+};
+
+bool
+readVerboseBinaryRecords(FILE *file, VerboseBinaryFileHeader *fileHeader, std::vector<VerboseBinaryRecord> *records)
+{
+	if (1 != fread(fileHeader, sizeof(*fileHeader), 1, file)) {
+		fprintf(stderr, "truncated file header\n");
+		return false;
+	}
+	if (0 != memcmp(fileHeader->magic, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH)) {
+		fprintf(stderr, "not a binary verbose GC stream\n");
+		return false;
+	}
+	if (VERBOSE_BINARY_BYTE_ORDER_MARK != fileHeader->byteOrderMark) {
+		fprintf(stderr, "stream was written with a different byte order\n");
+		return false;
+	}
+	if ((fileHeader->headerSize < sizeof(*fileHeader)) || (0 != fseek(file, (long)fileHeader->headerSize, SEEK_SET))) {
+		fprintf(stderr, "invalid file header size %u\n", (unsigned int)fileHeader->headerSize);
+		return false;
+	}
+
+	for (uintptr_t sequence = 0;; sequence++) {
+		VerboseBinaryRecord record;
+		if (1 != fread(&record.header, sizeof(record.header), 1, file)) {
+			break;
+		}
+		if ((record.header.length < sizeof(record.header)) || (0 != ((record.header.length - sizeof(record.header)) % sizeof(uint64_t)))) {
+			fprintf(stderr, "corrupt record length %u at record %zu, stopping\n", (unsigned int)record.header.length, (size_t)sequence);
+			break;
+		}
+		record.fields.resize((record.header.length - sizeof(record.header)) / sizeof(uint64_t));
+		if (!record.fields.empty() && (1 != fread(&record.fields[0], record.fields.size() * sizeof(uint64_t), 1, file))) {
+			fprintf(stderr, "truncated record at record %zu, stopping\n", (size_t)sequence);
+			break;
+		}
+		record.sequence = sequence;
+		records->push_back(record);
+	}
+
+	std::sort(records->begin(), records->end());
+	return true;
+}
+
+static void
+formatField(char *buffer, size_t bufferSize, const FieldDescription *field, uint64_t value, uint64_t frequency)
+{
+	switch (field->kind) {
+	case FIELD_TICKS:
+		snprintf(buffer, bufferSize, "%.3f", (double)value * 1000.0 / (double)frequency);
+		break;
+	case FIELD_NANOS:
+		snprintf(buffer, bufferSize, "%.3f", (double)value / 1000000.0);
+		break;
+	default:
+		snprintf(buffer, bufferSize, "%llu", (unsigned long long)value);
+		break;
+	}
+}
+
+void
+printVerboseBinaryRecords(FILE *output, const VerboseBinaryFileHeader *fileHeader, const std::vector<VerboseBinaryRecord> &records, bool csv)
+{
+	uint64_t frequency = (0 == fileHeader->hiresFrequency) ? 1 : fileHeader->hiresFrequency;
+	uintptr_t knownTypes = sizeof(recordDescriptions) / sizeof(recordDescriptions[0]);
+
+	if (csv) {
+		fprintf(output, "timeus,thread,event,fields\n");
+	} else {
+		fprintf(output, "<?xml version=\"1.0\" ?>\n\n<verbosegc-binary version=\"%u\" starttimems=\"%llu\" threads=\"%u\">\n",
+				(unsigned int)fileHeader->version, (unsigned long long)fileHeader->startWallTimeMillis, (unsigned int)fileHeader->threadCount);
+	}
+
+	for (std::vector<VerboseBinaryRecord>::const_iterator it = records.begin(); it != records.end(); ++it) {
+		const VerboseBinaryRecord &record = *it;
+		if ((VERBOSE_BINARY_RECORD_NONE == record.header.type) || (record.header.type >= knownTypes)) {
+			/* written by a newer producer; skip it */
+			continue;
+		}
+		const RecordDescription *description = &recordDescriptions[record.header.type];
+		int64_t ticks = (int64_t)(record.header.timestamp - fileHeader->startHiresTime);
+		double timeus = (double)ticks * 1000000.0 / (double)frequency;
+		uintptr_t fieldCount = std::min((uintptr_t)record.fields.size(), description->fieldCount);
+
+		if (csv) {
+			fprintf(output, "%.3f,%u,%s,", timeus, (unsigned int)record.header.threadIndex, description->name);
+		} else {
+			fprintf(output, "<%s timeus=\"%.3f\" thread=\"%u\"", description->name, timeus, (unsigned int)record.header.threadIndex);
+		}
+		for (uintptr_t i = 0; i < fieldCount; i++) {
+			char value[64];
+			formatField(value, sizeof(value), &description->fields[i], record.fields[i], frequency);
+			if (csv) {
+				fprintf(output, "%s%s=%s", (0 == i) ? "" : ";", description->fields[i].name, value);
+			} else {
+				fprintf(output, " %s=\"%s\"", description->fields[i].name, value);
+			}
+		}
+		fputs(csv ? "\n" : " />\n", output);
+	}
+
+	if (!csv) {
+		fprintf(output, "</verbosegc-binary>\n");
+	}
+}
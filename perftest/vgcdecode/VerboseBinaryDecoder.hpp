@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYDECODER_HPP_)
+#define VERBOSEBINARYDECODER_HPP_
+
+/**
+ * @file
+ * Reader for binary verbose GC streams (written with -Xgc:binaryLogging), shared by vgcdecode
+ * and the gc functional tests.
+ */
+
+#include <stdio.h>
+#include <vector>
+
+#include "VerboseBinaryFormat.hpp"
+
+struct VerboseBinaryRecord {
+	VerboseBinaryRecordHeader header;
+	std::vector<uint64_t> fields;
+	uintptr_t sequence; /**< position in the file, keeps the sort stable for equal timestamps */
+
+	bool operator<(const VerboseBinaryRecord &other) const
+	{
+		if (header.timestamp != other.header.timestamp) {
+			return header.timestamp < other.header.timestamp;
+		}
+		return sequence < other.sequence;
+	}
+};
+
+/**
+ * Read the header and all records of a stream.  Records are sorted by timestamp, since the writer
+ * drains its per-thread buffers independently.  A corrupt or truncated record ends the read.
+ * @param file[in] the stream, opened for binary reading
+ * @param fileHeader[out] the stream header
+ * @param records[out] the records of the stream
+ * @return false if the file is not a readable binary verbose GC stream, true otherwise
+ */
+bool readVerboseBinaryRecords(FILE *file, VerboseBinaryFileHeader *fileHeader, std::vector<VerboseBinaryRecord> *records);
+
+/**
+ * Print records as XML or CSV.  Times are reported in microseconds relative to the start of the stream
+ * and durations in milliseconds, matching the units of the XML verbose GC output.
+ * @param output[in] where to print
+ * @param fileHeader[in] the stream header
+ * @param records[in] the records, as returned by readVerboseBinaryRecords()
+ * @param csv[in] true to print CSV, false to print XML
+ */
+void printVerboseBinaryRecords(FILE *output, const VerboseBinaryFileHeader *fileHeader, const std::vector<VerboseBinaryRecord> &records, bool csv);
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */
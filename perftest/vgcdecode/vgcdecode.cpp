@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * Convert a binary verbose GC stream (written with -Xgc:binaryLogging) to XML or CSV.
+ *
+ * Usage: vgcdecode [-xml | -csv] <file>
+ *
+ * Records are sorted by timestamp before being printed, since the writer drains its per-thread
+ * buffers independently.  Times are reported in microseconds relative to the start of the stream
+ * and durations in milliseconds, matching the units of the XML verbose GC output.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "VerboseBinaryDecoder.hpp"
+
+int
+main(int argc, char **argv)
+{
+	bool csv = false;
+	const char *fileName = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-csv")) {
+			csv = true;
+		} else if (0 == strcmp(argv[i], "-xml")) {
+			csv = false;
+		} else if (NULL == fileName) {
+			fileName = argv[i];
+		} else {
+			fileName = NULL;
+			break;
+		}
+	}
+	if (NULL == fileName) {
+		fprintf(stderr, "usage: %s [-xml | -csv] <file>\n", argv[0]);
+		return 1;
+	}
+
+	FILE *file = fopen(fileName, "rb");
+	if (NULL == file) {
+		fprintf(stderr, "cannot open %s\n", fileName);
+		return 1;
+	}
+
+	VerboseBinaryFileHeader fileHeader;
+	std::vector<VerboseBinaryRecord> records;
+	bool success = readVerboseBinaryRecords(file, &fileHeader, &records);
+	fclose(file);
+	if (!success) {
+		return 1;
+	}
+
+	printVerboseBinaryRecords(stdout, &fileHeader, records, csv);
+	return 0;
+}
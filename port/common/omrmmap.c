@@ -266,3 +266,18 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
 	return;
 }
 
+/**
+ * Advise operating system to free resources in the given range, reporting what happened to the contents.
+ * @note The start address is rounded up to the nearest page boundary and the length is rounded down to a page boundary.
+ * @param startAddress start address of the data to disclaim
+ * @param length number of bytes to disclaim
+ * @param flags OMRPORT_MMAP_DONT_NEED_LAZY to let the operating system reclaim the pages only when it is short of memory
+ * @return OMRPORT_MMAP_DONT_NEED_ZEROED if the pages read as zero when next touched, OMRPORT_MMAP_DONT_NEED_RELEASED
+ * if they were released but may keep their contents, OMRPORT_MMAP_DONT_NEED_NOT_RELEASED if nothing was released
+ */
+int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags)
+{
+	return OMRPORT_MMAP_DONT_NEED_NOT_RELEASED;
+}
+
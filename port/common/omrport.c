@@ -252,6 +252,7 @@ static OMRPortLibrary MasterPortLibraryTable = {
 	omrmmap_protect, /* mmap_protect */
 	omrmmap_get_region_granularity, /* mmap_get_region_granularity */
 	omrmmap_dont_need, /* mmap_dont_need */
+	omrmmap_dont_need_ex, /* mmap_dont_need_ex */
 	omrsysinfo_get_limit, /* sysinfo_get_limit */
 	omrsysinfo_set_limit, /* sysinfo_set_limit */
 	omrsysinfo_get_number_CPUs_by_type, /* sysinfo_get_number_CPUs_by_type */
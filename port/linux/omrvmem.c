@@ -792,6 +792,18 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 	}
 #endif
 
+#if defined(MADV_HUGEPAGE)
+	if ((NULL != memoryPointer)
+		&& OMR_ARE_ANY_BITS_SET(params->options, OMRPORT_VMEM_TRANSPARENT_HUGE_PAGES)
+		&& (OMRPORT_VMEM_RESERVE_USED_MMAP == identifier->allocator)
+	) {
+		/* Advise the whole mapping: the advice survives the mprotect calls that commit parts of it.
+		 * It fails harmlessly when transparent huge pages are disabled in the kernel.
+		 */
+		madvise(identifier->address, (size_t)identifier->size, MADV_HUGEPAGE);
+	}
+#endif /* defined(MADV_HUGEPAGE) */
+
 #if defined(OMRVMEM_DEBUG)
 	printf("\tomrvmem_reserve_memory_ex(start=%p,end=%p,size=0x%zx,page=0x%zx,options=0x%zx) returning %p\n",
 			params->startAddress, params->endAddress, params->byteAmount, params->pageSize, (size_t)params->options, memoryPointer);
@@ -387,6 +387,8 @@ extern J9_CFUNC uintptr_t
 omrmmap_get_region_granularity(struct OMRPortLibrary *portLibrary, void *address);
 extern J9_CFUNC void
 omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length);
+extern J9_CFUNC int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags);
 
 /* J9SourceJ9NLS*/
 extern J9_CFUNC const char *
@@ -357,3 +357,62 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
 		}
 	}
 }
+
+/**
+ * Disclaim entire pages only, as for omrmmap_dont_need.
+ * With OMRPORT_MMAP_DONT_NEED_LAZY, Linux 4.5 and later free the pages with MADV_FREE: the kernel only reclaims
+ * them when it is short of memory, and until then they keep their contents and can be reused without a page fault.
+ * Otherwise MADV_DONTNEED drops the pages right away; private anonymous pages then read as zero.
+ */
+int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags)
+{
+	int32_t result = OMRPORT_MMAP_DONT_NEED_NOT_RELEASED;
+	size_t pageSize = portLibrary->mmap_get_region_granularity(portLibrary, (void *)startAddress);
+
+	Trc_PRT_mmap_dont_need(pageSize, startAddress, length);
+
+	if (pageSize > 0 && length >= pageSize) {
+		uintptr_t endAddress = (uintptr_t) startAddress + length;
+		uintptr_t roundedStart = ROUND_UP_TO_POWEROF2((uintptr_t) startAddress, pageSize);
+		size_t roundedLength = ROUND_DOWN_TO_POWEROF2(endAddress - roundedStart, pageSize);
+		if (roundedLength >= pageSize) {
+
+			Trc_PRT_mmap_dont_need_oscall(roundedStart, roundedLength);
+
+#if defined(LINUX)
+#if defined(MADV_FREE)
+			if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MMAP_DONT_NEED_LAZY)) {
+				if (0 == madvise((void *)roundedStart, roundedLength, MADV_FREE)) {
+					result = OMRPORT_MMAP_DONT_NEED_RELEASED;
+				} else {
+					/* EINVAL before Linux 4.5 and for mappings that are not private anonymous memory */
+					Trc_PRT_mmap_dont_need_ex_madvise_failed((void *)roundedStart, roundedLength, "MADV_FREE", errno);
+				}
+			}
+#endif /* defined(MADV_FREE) */
+			if (OMRPORT_MMAP_DONT_NEED_NOT_RELEASED == result) {
+				if (0 == madvise((void *)roundedStart, roundedLength, MADV_DONTNEED)) {
+					result = OMRPORT_MMAP_DONT_NEED_ZEROED;
+				} else {
+					Trc_PRT_mmap_dont_need_ex_madvise_failed((void *)roundedStart, roundedLength, "MADV_DONTNEED", errno);
+				}
+			}
+#elif defined(OSX)
+			/* MADV_FREE on OSX neither waits for memory pressure nor zeroes the pages */
+			if (0 == madvise((void *)roundedStart, roundedLength, MADV_DONTNEED)) {
+				result = OMRPORT_MMAP_DONT_NEED_RELEASED;
+			} else {
+				Trc_PRT_mmap_dont_need_ex_madvise_failed((void *)roundedStart, roundedLength, "MADV_DONTNEED", errno);
+			}
+#elif defined(AIXPPC)
+			if (0 == disclaim64((void *)roundedStart, roundedLength, DISCLAIM_ZEROMEM)) {
+				result = OMRPORT_MMAP_DONT_NEED_ZEROED;
+			} else {
+				Trc_PRT_mmap_dont_need_disclaim64_failed((void *)roundedStart, roundedLength, errno);
+			}
+#endif /* defined(AIXPPC) */
+		}
+	}
+	return result;
+}
@@ -353,3 +353,32 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
 		}
 	}
 }
+
+int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags)
+{
+	int32_t result = OMRPORT_MMAP_DONT_NEED_NOT_RELEASED;
+
+	if (OMR_ARE_ANY_BITS_SET(flags, OMRPORT_MMAP_DONT_NEED_LAZY)) {
+		size_t pageSize = portLibrary->mmap_get_region_granularity(portLibrary, (void *)startAddress);
+
+		Trc_PRT_mmap_dont_need(pageSize, startAddress, length);
+
+		if (pageSize > 0 && length >= pageSize) {
+			uintptr_t endAddress = (uintptr_t) startAddress + length;
+			uintptr_t roundedStart = ROUND_UP_TO_POWEROF2((uintptr_t) startAddress, pageSize);
+			size_t roundedLength = ROUND_DOWN_TO_POWEROF2(endAddress - roundedStart, pageSize);
+			Trc_PRT_mmap_dont_need_oscall(roundedStart, roundedLength);
+			if (roundedLength >= pageSize) {
+				/* MEM_RESET: the pages are not written to the paging file and may be reclaimed, keeping their contents until then */
+				if (NULL != VirtualAlloc((LPVOID) roundedStart, roundedLength, MEM_RESET, PAGE_NOACCESS)) {
+					result = OMRPORT_MMAP_DONT_NEED_RELEASED;
+				}
+			}
+		}
+	} else {
+		portLibrary->mmap_dont_need(portLibrary, startAddress, length);
+		result = OMRPORT_MMAP_DONT_NEED_RELEASED;
+	}
+	return result;
+}
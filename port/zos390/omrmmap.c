@@ -184,6 +184,13 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
 	}
 }
 
+int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags)
+{
+	portLibrary->mmap_dont_need(portLibrary, startAddress, length);
+	return OMRPORT_MMAP_DONT_NEED_RELEASED;
+}
+
 
 
 
@@ -186,3 +186,16 @@ omrmmap_dont_need(struct OMRPortLibrary *portLibrary, const void *startAddress,
         return;
 }
 
+/**
+ * Advise operating system to free resources in the given range, reporting what happened to the contents.
+ * @param startAddress start address of the data to disclaim
+ * @param length number of bytes to disclaim
+ * @param flags OMRPORT_MMAP_DONT_NEED_LAZY to let the operating system reclaim the pages only when it is short of memory
+ * @return OMRPORT_MMAP_DONT_NEED_NOT_RELEASED, nothing is released on this platform
+ */
+int32_t
+omrmmap_dont_need_ex(struct OMRPortLibrary *portLibrary, const void *startAddress, size_t length, uintptr_t flags)
+{
+        return OMRPORT_MMAP_DONT_NEED_NOT_RELEASED;
+}
+
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Waiting on the value of a memory word, where the platform has no such primitive.
+ */
+#include "omrcfg.h"
+#include "threaddef.h"
+
+/**
+ * Answer whether omrthread_address_wait() and omrthread_address_wake_all() are available.
+ * Callers that cannot use them must wait on a monitor instead.
+ *
+ * @return FALSE, there is no address based wait on this platform
+ */
+BOOLEAN
+omrthread_address_wait_supported(void)
+{
+	return FALSE;
+}
+
+/**
+ * Not supported on this platform.
+ *
+ * @return J9THREAD_ERR_UNSUPPORTED_PLAT
+ */
+intptr_t
+omrthread_address_wait(volatile uint32_t *address, uint32_t value)
+{
+	return J9THREAD_ERR_UNSUPPORTED_PLAT;
+}
+
+/**
+ * Not supported on this platform.
+ *
+ * @return J9THREAD_ERR_UNSUPPORTED_PLAT
+ */
+intptr_t
+omrthread_address_wake_all(volatile uint32_t *address)
+{
+	return J9THREAD_ERR_UNSUPPORTED_PLAT;
+}
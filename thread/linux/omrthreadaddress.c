@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Thread
+ * @brief Waiting on the value of a memory word, using a futex.
+ */
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "omrcfg.h"
+#include "threaddef.h"
+
+/**
+ * Answer whether omrthread_address_wait() and omrthread_address_wake_all() are available.
+ * Callers that cannot use them must wait on a monitor instead.
+ *
+ * @return TRUE, every Linux kernel supports private futexes
+ */
+BOOLEAN
+omrthread_address_wait_supported(void)
+{
+	return TRUE;
+}
+
+/**
+ * Block the calling thread while *address holds value, until omrthread_address_wake_all() is called on address.
+ * The value is compared atomically with going to sleep, so a wake up sent after *address changed is never lost.
+ * The thread may also return spuriously, so the caller must check *address again.
+ *
+ * @param[in] address the word to wait on; it is only shared between threads of this process
+ * @param[in] value the value *address must still hold for the thread to block
+ * @return J9THREAD_SUCCESS
+ */
+intptr_t
+omrthread_address_wait(volatile uint32_t *address, uint32_t value)
+{
+	/* EAGAIN (*address changed) and EINTR are both just an early return */
+	syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+	return J9THREAD_SUCCESS;
+}
+
+/**
+ * Wake every thread blocked in omrthread_address_wait() on address.
+ *
+ * @param[in] address the word the threads wait on
+ * @return J9THREAD_SUCCESS
+ */
+intptr_t
+omrthread_address_wake_all(volatile uint32_t *address)
+{
+	syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+	return J9THREAD_SUCCESS;
+}
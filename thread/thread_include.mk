@@ -32,6 +32,7 @@ THREAD_SRCDIR ?= ./
 OBJECTS :=\
   j9sem \
   omrthread \
+  omrthreadaddress \
   omrthreadattr \
   omrthreaddebug \
   omrthreaderror \
@@ -207,6 +208,9 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_rwmutex_is_writelocked >>$@
 @echo omrthread_park >>$@
 @echo omrthread_unpark >>$@
+@echo omrthread_address_wait_supported >>$@
+@echo omrthread_address_wait >>$@
+@echo omrthread_address_wake_all >>$@
 @echo omrthread_numa_get_max_node >>$@
 @echo omrthread_numa_set_enabled >>$@
 @echo omrthread_numa_set_node_affinity >>$@
@@ -26,6 +26,12 @@
 
 #include <string.h>
 
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && (defined(__GNUC__) || defined(_MSC_VER))
+/* SSE2 is part of the x86-64 baseline, so streaming stores need no feature check */
+#include <emmintrin.h>
+#define OMR_ZERO_MEMORY_STREAMING
+#endif
+
 #if defined(__xlC__)
 void dcbz(char *);
 #pragma mc_func dcbz  {"7c001fec"}  /* dcbz, 0, r3 */
@@ -182,6 +188,44 @@ OMRZeroMemory(void *ptr, uintptr_t length)
 #endif
 }
 
+void
+OMRZeroMemoryNonTemporal(void *ptr, uintptr_t length)
+{
+#if defined(OMR_ZERO_MEMORY_STREAMING)
+	uint8_t *addr = (uint8_t *)ptr;
+	uint8_t *limit = NULL;
+	__m128i zero;
+
+	/* Streaming stores only pay off once whole cache lines are written */
+	if (length < 256) {
+		memset(ptr, 0, (size_t)length);
+		return;
+	}
+
+	/* Zero any initial portion to the first 64-byte boundary with ordinary stores */
+	limit = (uint8_t *)(((uintptr_t)addr + 63) & ~(uintptr_t)63);
+	memset(addr, 0, (size_t)(limit - addr));
+	addr = limit;
+
+	/* Stream full cache lines straight to memory */
+	zero = _mm_setzero_si128();
+	limit = (uint8_t *)(((uintptr_t)ptr + length) & ~(uintptr_t)63);
+	for (; addr < limit; addr += 64) {
+		_mm_stream_si128((__m128i *)addr, zero);
+		_mm_stream_si128((__m128i *)(addr + 16), zero);
+		_mm_stream_si128((__m128i *)(addr + 32), zero);
+		_mm_stream_si128((__m128i *)(addr + 48), zero);
+	}
+
+	/* Streaming stores are weakly ordered: make them visible before any store that follows */
+	_mm_sfence();
+
+	/* Zero the final portion smaller than a cache line */
+	memset(addr, 0, (size_t)((uint8_t *)ptr + length - addr));
+#else /* defined(OMR_ZERO_MEMORY_STREAMING) */
+	OMRZeroMemory(ptr, length);
+#endif /* defined(OMR_ZERO_MEMORY_STREAMING) */
+}
 
 uintptr_t
 getCacheLineSize(void)